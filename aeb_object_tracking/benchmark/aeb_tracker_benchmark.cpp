@@ -0,0 +1,517 @@
+/// @file aeb_tracker_benchmark.cpp
+/// @brief Google Benchmark suite for the tracker operations.
+/// @details Every benchmark generates its frame from a fixed seed, so runs
+/// on the same machine and toolchain see identical inputs and their JSON
+/// results can be compared. Object counts sweep from 10 to 1M.
+
+#include <benchmark/benchmark.h>  // for State, DoNotOptimize, BENCHMARK
+#include <algorithm>              // for sort, stable_sort
+#include <cstddef>                // for size_t
+#include <cstdint>                // for int64_t, uint32_t
+#include <numeric>                // for iota
+#include <random>                 // for mt19937, uniform_real_distribution
+#include <vector>                 // for vector
+#include "aeb_collision_forecast.h" // for CollisionForecast, ForecastHor...
+#include "aeb_columnar_tracker.h" // for ColumnarObjectTracker
+#include "aeb_scenario_generator.h" // for ScenarioGenerator, ScenarioConfig
+#include "aeb_tracker.h"          // for AEBObjectTracker, DetectedObject
+
+namespace aeb {
+namespace object_tracking {
+namespace benchmarks {
+
+namespace {
+
+constexpr std::uint32_t kFrameSeed = 20240521U;
+constexpr std::int64_t kMinObjects = 10;
+constexpr std::int64_t kMaxObjects = 1000000;
+constexpr float kCriticalThreshold = 2.0f;
+
+/// @brief Frame of count objects, identical for a given count.
+std::vector<DetectedObject> makeFrame(std::size_t count) {
+  std::mt19937 gen(kFrameSeed);
+  std::uniform_real_distribution<float> dist_range(5.0f, 200.0f);
+  std::uniform_real_distribution<float> vel_range(-25.0f, 10.0f);
+
+  std::vector<DetectedObject> frame;
+  frame.reserve(count);
+  for (std::size_t i = 0; i < count; ++i) {
+    const float distance = dist_range(gen);
+    frame.emplace_back(static_cast<int>(i), distance, vel_range(gen));
+  }
+  return frame;
+}
+
+/// @brief Replace the tracker contents with frame.
+void loadFrame(AEBObjectTracker &tracker,
+               std::vector<DetectedObject> const &frame) {
+  tracker.clear();
+  for (auto const &object : frame) {
+    tracker.addObject(object);
+  }
+}
+
+std::size_t objectCount(benchmark::State const &state) {
+  return static_cast<std::size_t>(state.range(0));
+}
+
+void finish(benchmark::State &state) {
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+/// @brief Benchmark a sort that needs a fresh copy of frame on every
+/// iteration.
+template <typename Sort>
+void runSort(benchmark::State &state, AEBObjectTracker &tracker,
+             std::vector<DetectedObject> const &frame, Sort sort) {
+  tracker.reserveCapacity(frame.size());
+  for (auto _ : state) {
+    state.PauseTiming();
+    loadFrame(tracker, frame);
+    state.ResumeTiming();
+    sort(tracker);
+    benchmark::ClobberMemory();
+  }
+  finish(state);
+}
+
+/// @brief Object-count sweep 10, 100, ..., 1M.
+void objectSweep(benchmark::internal::Benchmark *bench) {
+  bench->RangeMultiplier(10)->Range(kMinObjects, kMaxObjects);
+}
+
+/// @brief K x N grid for the partial sort.
+void criticalGrid(benchmark::internal::Benchmark *bench) {
+  for (std::int64_t count = kMinObjects; count <= kMaxObjects; count *= 10) {
+    for (std::int64_t k : {1, 5, 10, 50}) {
+      if (k <= count) {
+        bench->Args({count, k});
+      }
+    }
+  }
+  bench->ArgNames({"objects", "k"});
+}
+
+/// @brief Every scenario x object counts 100, 10k, 1M.
+void scenarioGrid(benchmark::internal::Benchmark *bench) {
+  for (std::int64_t type = 0;
+       type <= static_cast<std::int64_t>(ScenarioType::kMixed); ++type) {
+    for (std::int64_t count = 100; count <= kMaxObjects; count *= 100) {
+      bench->Args({type, count});
+    }
+  }
+  bench->ArgNames({"scenario", "objects"});
+}
+
+ScenarioConfig scenarioConfig(benchmark::State &state) {
+  ScenarioConfig config;
+  config.type = static_cast<ScenarioType>(state.range(0));
+  config.object_count = static_cast<std::size_t>(state.range(1));
+  state.SetLabel(toString(config.type));
+  return config;
+}
+
+/// @brief Replace the tracker contents with frame, objects in given order.
+void loadFrameInOrder(AEBObjectTracker &tracker, ObjectRange frame,
+                      std::vector<std::size_t> const &order) {
+  tracker.clear();
+  for (const std::size_t index : order) {
+    tracker.addObject(frame[index]);
+  }
+}
+
+} // namespace
+
+// --- Ingest ---------------------------------------------------------------
+
+void BM_AddObject(benchmark::State &state) {
+  const auto frame = makeFrame(objectCount(state));
+  AEBObjectTracker tracker;
+  tracker.reserveCapacity(frame.size());
+  for (auto _ : state) {
+    loadFrame(tracker, frame);
+    benchmark::DoNotOptimize(tracker.getObjects().data());
+  }
+  finish(state);
+}
+BENCHMARK(BM_AddObject)->Apply(objectSweep);
+
+void BM_ColumnarAddObjects(benchmark::State &state) {
+  const auto frame = makeFrame(objectCount(state));
+  std::vector<int> ids;
+  std::vector<float> distances;
+  std::vector<float> velocities;
+  for (auto const &object : frame) {
+    ids.push_back(object.getId());
+    distances.push_back(object.getDistance());
+    velocities.push_back(object.getRelativeVelocity());
+  }
+  ColumnarObjectTracker tracker;
+  tracker.reserveCapacity(frame.size());
+  for (auto _ : state) {
+    tracker.clear();
+    tracker.addObjects(ids.data(), distances.data(), velocities.data(),
+                       ids.size());
+    benchmark::DoNotOptimize(tracker.getCollisionTimes().data());
+  }
+  finish(state);
+}
+BENCHMARK(BM_ColumnarAddObjects)->Apply(objectSweep);
+
+void BM_AddObjectsWithAcceleration(benchmark::State &state) {
+  // Constant-acceleration TTC with ego compensation: per-object
+  // construction vs. the vectorized batch ingest.
+  const bool batch = state.range(1) != 0;
+  const auto frame = makeFrame(objectCount(state));
+  const EgoMotion ego{25.0f, -1.0f};
+  std::vector<int> ids;
+  std::vector<float> distances;
+  std::vector<float> velocities;
+  std::vector<float> accelerations;
+  for (auto const &object : frame) {
+    ids.push_back(object.getId());
+    distances.push_back(object.getDistance());
+    velocities.push_back(object.getRelativeVelocity() + ego.speed);
+    accelerations.push_back(static_cast<float>(object.getId() % 9 - 4));
+  }
+  AEBObjectTracker tracker;
+  tracker.reserveCapacity(frame.size());
+  for (auto _ : state) {
+    tracker.clear();
+    if (batch) {
+      tracker.addObjects(ids.data(), distances.data(), velocities.data(),
+                         accelerations.data(), ids.size(), ego);
+    } else {
+      for (std::size_t i = 0; i < ids.size(); ++i) {
+        tracker.addObject(DetectedObject(ids[i], distances[i],
+                                         velocities[i] - ego.speed,
+                                         accelerations[i] - ego.acceleration));
+      }
+    }
+    benchmark::DoNotOptimize(tracker.getObjects().data());
+  }
+  finish(state);
+}
+BENCHMARK(BM_AddObjectsWithAcceleration)
+    ->ArgsProduct({benchmark::CreateRange(kMinObjects, kMaxObjects, 10),
+                   {0, 1}})
+    ->ArgNames({"objects", "batch"});
+
+// --- Sorts ----------------------------------------------------------------
+
+void BM_SortByCollisionTime(benchmark::State &state) {
+  AEBObjectTracker tracker;
+  runSort(state, tracker, makeFrame(objectCount(state)),
+          [](AEBObjectTracker &t) { t.sortByCollisionTime(); });
+}
+BENCHMARK(BM_SortByCollisionTime)->Apply(objectSweep);
+
+void BM_SortByCollisionTimeRadix(benchmark::State &state) {
+  AEBObjectTracker tracker;
+  tracker.setSortMode(AEBObjectTracker::SortMode::kRadixKey);
+  runSort(state, tracker, makeFrame(objectCount(state)),
+          [](AEBObjectTracker &t) { t.sortByCollisionTime(); });
+}
+BENCHMARK(BM_SortByCollisionTimeRadix)->Apply(objectSweep);
+
+void BM_SortByCollisionTimeParallel(benchmark::State &state) {
+  AEBObjectTracker tracker;
+  runSort(state, tracker, makeFrame(objectCount(state)),
+          [](AEBObjectTracker &t) {
+            t.sortByCollisionTime(ParallelSortOptions{});
+          });
+}
+BENCHMARK(BM_SortByCollisionTimeParallel)->Apply(objectSweep)->UseRealTime();
+
+void BM_SortByThreatLevel(benchmark::State &state) {
+  AEBObjectTracker tracker;
+  runSort(state, tracker, makeFrame(objectCount(state)),
+          [](AEBObjectTracker &t) { t.sortByThreatLevel(); });
+}
+BENCHMARK(BM_SortByThreatLevel)->Apply(objectSweep);
+
+void BM_SortMultiCriteria(benchmark::State &state) {
+  AEBObjectTracker tracker;
+  runSort(state, tracker, makeFrame(objectCount(state)),
+          [](AEBObjectTracker &t) { t.sortMultiCriteria(); });
+}
+BENCHMARK(BM_SortMultiCriteria)->Apply(objectSweep);
+
+void BM_SortMultiCriteriaRadix(benchmark::State &state) {
+  AEBObjectTracker tracker;
+  tracker.setSortMode(AEBObjectTracker::SortMode::kRadixKey);
+  runSort(state, tracker, makeFrame(objectCount(state)),
+          [](AEBObjectTracker &t) { t.sortMultiCriteria(); });
+}
+BENCHMARK(BM_SortMultiCriteriaRadix)->Apply(objectSweep);
+
+void BM_ResortByCollisionTime(benchmark::State &state) {
+  // Sorted frame where every object moved slightly: the frame-to-frame case.
+  AEBObjectTracker sorted;
+  loadFrame(sorted, makeFrame(objectCount(state)));
+  sorted.sortByCollisionTime();
+  std::vector<DetectedObject> frame;
+  frame.reserve(sorted.size());
+  for (auto const &object : sorted.getObjects()) {
+    const float jitter = (object.getId() % 7 == 0) ? -0.5f : 0.1f;
+    frame.emplace_back(object.getId(), object.getDistance() + jitter,
+                       object.getRelativeVelocity());
+  }
+  AEBObjectTracker tracker;
+  runSort(state, tracker, frame,
+          [](AEBObjectTracker &t) { t.resortByCollisionTime(); });
+}
+BENCHMARK(BM_ResortByCollisionTime)->Apply(objectSweep);
+
+void BM_ColumnarSortByCollisionTime(benchmark::State &state) {
+  const auto frame = makeFrame(objectCount(state));
+  ColumnarObjectTracker tracker;
+  tracker.reserveCapacity(frame.size());
+  for (auto _ : state) {
+    state.PauseTiming();
+    tracker.clear();
+    for (auto const &object : frame) {
+      tracker.addObject(object);
+    }
+    state.ResumeTiming();
+    tracker.sortByCollisionTime();
+    benchmark::ClobberMemory();
+  }
+  finish(state);
+}
+BENCHMARK(BM_ColumnarSortByCollisionTime)->Apply(objectSweep);
+
+void BM_MergeSortedRuns(benchmark::State &state) {
+  // Three pre-sorted sensor lists, merged instead of sorted.
+  constexpr std::size_t kSensors = 3U;
+  const auto frame = makeFrame(objectCount(state));
+  std::vector<std::vector<DetectedObject>> runs(kSensors);
+  for (std::size_t i = 0; i < frame.size(); ++i) {
+    runs[i % kSensors].push_back(frame[i]);
+  }
+  std::vector<ObjectRange> ranges;
+  for (auto &run : runs) {
+    std::sort(run.begin(), run.end(),
+              AEBObjectTracker::Comparators::byCollisionTime);
+    ranges.emplace_back(run.data(), run.size());
+  }
+  AEBObjectTracker tracker;
+  tracker.reserveCapacity(frame.size());
+  for (auto _ : state) {
+    tracker.mergeSortedRuns(ranges.data(), ranges.size());
+    benchmark::ClobberMemory();
+  }
+  finish(state);
+}
+BENCHMARK(BM_MergeSortedRuns)->Apply(objectSweep);
+
+void BM_PartialSortCriticalObjects(benchmark::State &state) {
+  const auto frame = makeFrame(objectCount(state));
+  const auto k = static_cast<std::size_t>(state.range(1));
+  AEBObjectTracker tracker;
+  tracker.reserveCapacity(frame.size());
+  for (auto _ : state) {
+    state.PauseTiming();
+    loadFrame(tracker, frame);
+    state.ResumeTiming();
+    tracker.partialSortCriticalObjects(k);
+    benchmark::ClobberMemory();
+  }
+  finish(state);
+}
+BENCHMARK(BM_PartialSortCriticalObjects)->Apply(criticalGrid);
+
+// --- Scenarios ------------------------------------------------------------
+
+void BM_ScenarioSortByCollisionTime(benchmark::State &state) {
+  // Full sort of each new frame, as delivered in sensor (track) order.
+  const ScenarioConfig config = scenarioConfig(state);
+  ScenarioGenerator generator(config);
+  AEBObjectTracker tracker;
+  tracker.reserveCapacity(config.object_count);
+  for (auto _ : state) {
+    state.PauseTiming();
+    const ObjectRange frame = generator.nextFrame();
+    tracker.clear();
+    for (auto const &object : frame) {
+      tracker.addObject(object);
+    }
+    state.ResumeTiming();
+    tracker.sortByCollisionTime();
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(1));
+}
+BENCHMARK(BM_ScenarioSortByCollisionTime)->Apply(scenarioGrid);
+
+void BM_ScenarioResortByCollisionTime(benchmark::State &state) {
+  // Each frame is loaded in the previous frame's TTC order, as a tracker
+  // keeping its track order would see it: the realistic nearly sorted case.
+  const ScenarioConfig config = scenarioConfig(state);
+  ScenarioGenerator generator(config);
+  std::vector<std::size_t> order(config.object_count);
+  std::iota(order.begin(), order.end(), std::size_t{0});
+  std::vector<float> previous_ttc(order.size());
+  AEBObjectTracker tracker;
+  tracker.reserveCapacity(order.size());
+  for (auto _ : state) {
+    state.PauseTiming();
+    const ObjectRange frame = generator.nextFrame();
+    loadFrameInOrder(tracker, frame, order);
+    state.ResumeTiming();
+    tracker.resortByCollisionTime();
+    benchmark::ClobberMemory();
+    state.PauseTiming();
+    for (std::size_t i = 0; i < frame.size(); ++i) {
+      previous_ttc[i] = frame[i].getCollisionTime();
+    }
+    std::stable_sort(order.begin(), order.end(),
+                     [&previous_ttc](std::size_t a, std::size_t b) {
+                       return previous_ttc[a] < previous_ttc[b];
+                     });
+    state.ResumeTiming();
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(1));
+}
+BENCHMARK(BM_ScenarioResortByCollisionTime)->Apply(scenarioGrid);
+
+void BM_ScenarioPipeline(benchmark::State &state) {
+  // Ingest, critical-object sort and threshold decision per frame.
+  constexpr std::size_t kCriticalObjects = 5U;
+  const ScenarioConfig config = scenarioConfig(state);
+  ScenarioGenerator generator(config);
+  AEBObjectTracker tracker;
+  tracker.reserveCapacity(config.object_count);
+  ThresholdClassification classification;
+  const std::vector<float> thresholds = {kCriticalThreshold, 5.0f};
+  for (auto _ : state) {
+    state.PauseTiming();
+    const ObjectRange frame = generator.nextFrame();
+    state.ResumeTiming();
+    tracker.clear();
+    for (auto const &object : frame) {
+      tracker.addObject(object);
+    }
+    tracker.partialSortCriticalObjects(kCriticalObjects);
+    tracker.classifyByThresholds(thresholds, classification);
+    benchmark::DoNotOptimize(classification.anyWithin(0U));
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(1));
+}
+BENCHMARK(BM_ScenarioPipeline)->Apply(scenarioGrid);
+
+// --- Forecast -------------------------------------------------------------
+
+void BM_ForecastCriticalObjects(benchmark::State &state) {
+  // Top-5 at 4 steps of 50 ms: one sweep vs. a sorted copy per step.
+  const bool sweep = state.range(1) != 0;
+  const auto frame = makeFrame(objectCount(state));
+  AEBObjectTracker tracker;
+  loadFrame(tracker, frame);
+  ForecastHorizon horizon;
+  CollisionForecast forecast;
+  AEBObjectTracker copy;
+  copy.reserveCapacity(frame.size());
+  for (auto _ : state) {
+    if (sweep) {
+      tracker.forecastCriticalObjects(horizon, forecast);
+      benchmark::DoNotOptimize(forecast.criticalObjects(0U).data());
+    } else {
+      for (std::size_t s = 0; s < horizon.step_count; ++s) {
+        const float seconds =
+            static_cast<float>(s + 1U) * horizon.step_seconds;
+        copy.clear();
+        for (auto const &object : frame) {
+          const bool reached = object.getCollisionTime() <= seconds;
+          copy.addObject(DetectedObject(
+              object.getId(),
+              reached ? 0.0f
+                      : object.getDistance() +
+                            object.getRelativeVelocity() * seconds,
+              object.getRelativeVelocity()));
+        }
+        copy.partialSortCriticalObjects(horizon.max_objects);
+        benchmark::DoNotOptimize(copy.getObjects().data());
+      }
+    }
+  }
+  finish(state);
+}
+BENCHMARK(BM_ForecastCriticalObjects)
+    ->ArgsProduct({benchmark::CreateRange(kMinObjects, kMaxObjects, 10),
+                   {0, 1}})
+    ->ArgNames({"objects", "sweep"});
+
+// --- Queries --------------------------------------------------------------
+
+void BM_GetObjectsWithinTimeThreshold(benchmark::State &state) {
+  AEBObjectTracker tracker;
+  loadFrame(tracker, makeFrame(objectCount(state)));
+  for (auto _ : state) {
+    auto result = tracker.getObjectsWithinTimeThreshold(kCriticalThreshold);
+    benchmark::DoNotOptimize(result.data());
+  }
+  finish(state);
+}
+BENCHMARK(BM_GetObjectsWithinTimeThreshold)->Apply(objectSweep);
+
+void BM_GetObjectIndicesWithinTimeThreshold(benchmark::State &state) {
+  AEBObjectTracker tracker;
+  loadFrame(tracker, makeFrame(objectCount(state)));
+  std::vector<std::size_t> indices;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(
+        tracker.getObjectIndicesWithinTimeThreshold(kCriticalThreshold,
+                                                    indices));
+  }
+  finish(state);
+}
+BENCHMARK(BM_GetObjectIndicesWithinTimeThreshold)->Apply(objectSweep);
+
+void BM_HasCriticalObjects(benchmark::State &state) {
+  // Nothing within 0 s: the worst case scans the whole frame.
+  AEBObjectTracker tracker;
+  loadFrame(tracker, makeFrame(objectCount(state)));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(tracker.hasCriticalObjects(0.0f));
+  }
+  finish(state);
+}
+BENCHMARK(BM_HasCriticalObjects)->Apply(objectSweep);
+
+void BM_ClassifyByThresholds(benchmark::State &state) {
+  AEBObjectTracker tracker;
+  loadFrame(tracker, makeFrame(objectCount(state)));
+  const std::vector<float> thresholds = {1.0f, 2.0f, 5.0f};
+  ThresholdClassification classification;
+  for (auto _ : state) {
+    tracker.classifyByThresholds(thresholds, classification);
+    benchmark::DoNotOptimize(classification.count(0U));
+  }
+  finish(state);
+}
+BENCHMARK(BM_ClassifyByThresholds)->Apply(objectSweep);
+
+void BM_FindObjectById(benchmark::State &state) {
+  const bool indexed = state.range(1) != 0;
+  const std::size_t count = objectCount(state);
+  AEBObjectTracker tracker;
+  tracker.enableIdIndex(indexed);
+  loadFrame(tracker, makeFrame(count));
+  // Look up IDs spread over the whole frame.
+  int id = 0;
+  const int stride = static_cast<int>(count / 7U) + 1;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(tracker.findObjectById(id));
+    id = (id + stride) % static_cast<int>(count);
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_FindObjectById)
+    ->ArgsProduct({benchmark::CreateRange(kMinObjects, kMaxObjects, 10),
+                   {0, 1}})
+    ->ArgNames({"objects", "indexed"});
+
+} // namespace benchmarks
+} // namespace object_tracking
+} // namespace aeb
@@ -0,0 +1,92 @@
+/// @file aeb_collision_forecast.h
+/// @brief Predicted most critical objects over a short time horizon.
+/// @details Answers "who will be critical in 200 ms?" for every step of a
+/// horizon at once. Objects are extrapolated in a single sweep over the
+/// frame, and only the K most critical objects of each step are kept, so no
+/// extrapolated copy of the frame is ever stored.
+
+#ifndef AEB_OBJECT_TRACKING_INCLUDE_AEB_COLLISION_FORECAST_H
+#define AEB_OBJECT_TRACKING_INCLUDE_AEB_COLLISION_FORECAST_H
+
+#include <cstddef>                    // for size_t
+#include <memory_resource>            // for memory_resource, vector
+#include "aeb_critical_object_set.h"  // for CriticalObjectSet
+#include "aeb_detected_object.h"      // for DetectedObject, ObjectRange
+
+namespace aeb {
+namespace object_tracking {
+
+/// @brief Time steps to forecast.
+struct ForecastHorizon {
+  float step_seconds{0.05f};   ///< Step s is (s + 1) * step_seconds ahead
+  std::size_t step_count{4U};  ///< Number of steps
+  std::size_t max_objects{5U}; ///< Critical objects kept per step (K)
+};
+
+/// @brief Predicted top-K per time step.
+/// @details Objects keep their ID; distance, relative velocity, TTC and
+/// threat level are the predicted values at the step. Motion is
+/// extrapolated with constant relative acceleration: each object's own,
+/// recovered from its stored TTC by impliedRelativeAcceleration() (0 for
+/// constant-velocity objects, the acceleration of
+/// AEBObjectTracker::addObjects() otherwise), plus an optional ego
+/// acceleration (e.g. a planned braking) that applies to every object. An
+/// object whose TTC runs out before a step is predicted at distance 0 with
+/// TTC 0, i.e. as the most critical object of that step.
+///
+/// The frame is processed in chunks: each chunk is converted to columns
+/// once and extrapolated to every step with simd::projectCollisionTimes()
+/// while it is in L1, and the predictions are offered to one
+/// CriticalObjectSet per step. Storage is reused between forecasts.
+///
+class CollisionForecast {
+public:
+  /// @param resource Memory resource for the per-step sets.
+  explicit CollisionForecast(
+      std::pmr::memory_resource *resource = std::pmr::get_default_resource());
+
+  /// @brief Start a new forecast with empty steps.
+  /// @param horizon Steps and K.
+  /// @param ego_acceleration Ego acceleration in m/s^2 assumed over the
+  /// horizon; negative = braking, which opens the gap to every object.
+  void reset(ForecastHorizon const &horizon, float ego_acceleration = 0.0f);
+
+  /// @brief Extrapolate objects to every step and keep the most critical.
+  /// @details May be called several times per forecast, e.g. per sensor.
+  /// Time complexity: O(n * steps * K) in the worst case, O(n * steps)
+  /// when few objects enter the top-K.
+  /// @param objects Objects with their current state.
+  void project(ObjectRange objects);
+
+  /// @brief The horizon of the current forecast.
+  ForecastHorizon const &horizon() const noexcept { return horizon_; }
+
+  /// @brief Number of steps.
+  std::size_t stepCount() const noexcept { return horizon_.step_count; }
+
+  /// @brief Time of a step in seconds from now.
+  /// @param step Step index in [0, stepCount()).
+  float stepTime(std::size_t step) const noexcept {
+    return static_cast<float>(step + 1U) * horizon_.step_seconds;
+  }
+
+  /// @brief Predicted most critical objects at a step, most critical first.
+  /// @param step Step index in [0, stepCount()).
+  ObjectRange criticalObjects(std::size_t step) const noexcept {
+    return steps_[step].objects();
+  }
+
+private:
+  /// Objects per chunk (ten stack-sized column buffers).
+  static constexpr std::size_t kChunkSize = 256U;
+
+  std::pmr::memory_resource *resource_;
+  ForecastHorizon horizon_{};
+  float relative_acceleration_{0.0f}; ///< m/s^2, -ego acceleration
+  std::pmr::vector<CriticalObjectSet> steps_;
+};
+
+} // namespace object_tracking
+} // namespace aeb
+
+#endif // AEB_OBJECT_TRACKING_INCLUDE_AEB_COLLISION_FORECAST_H
@@ -0,0 +1,137 @@
+/// @file aeb_collision_model.h
+/// @brief Scalar Time-To-Collision (TTC) and threat level model.
+/// @details Single definition of the formulas used by DetectedObject and by
+/// the batch (SIMD) kernels, so that every code path produces bit-identical
+/// results.
+
+#ifndef AEB_OBJECT_TRACKING_INCLUDE_AEB_COLLISION_MODEL_H
+#define AEB_OBJECT_TRACKING_INCLUDE_AEB_COLLISION_MODEL_H
+
+#include <algorithm>  // for max
+#include <cmath>      // for isinf, sqrt
+#include <limits>     // for numeric_limits
+
+namespace aeb {
+namespace object_tracking {
+
+/// @brief Relative velocity (m/s) below which an object counts as approaching.
+constexpr float kApproachingVelocityThreshold = -0.1f;
+
+/// @brief TTC (s) below which the threat level saturates at 1.0.
+constexpr float kImminentCollisionTime = 1.0f;
+
+/// @brief TTC (s) above which the threat level drops to 0.0.
+constexpr float kIrrelevantCollisionTime = 10.0f;
+
+/// @brief Distance (m) at which the distance factor of the threat level
+/// reaches 0.0.
+constexpr float kThreatDistanceRange = 100.0f;
+
+/// @brief Calculate Time-To-Collision (TTC).
+/// Formula: TTC = distance / |relative_velocity| for approaching objects,
+/// infinity otherwise.
+/// @param distance Distance in meters.
+/// @param relative_velocity Relative velocity in m/s (negative = approaching).
+/// @return TTC in seconds.
+constexpr float computeCollisionTime(float distance,
+                                     float relative_velocity) noexcept {
+  return (relative_velocity < kApproachingVelocityThreshold)
+             ? distance / (-relative_velocity)
+             : std::numeric_limits<float>::infinity();
+}
+
+/// @brief Longitudinal motion of the ego vehicle.
+/// @details Subtracted from object motion measured over ground to get the
+/// relative motion the TTC model needs. The default (ego at rest) leaves
+/// relative measurements unchanged.
+struct EgoMotion {
+  float speed{0.0f};        ///< m/s
+  float acceleration{0.0f}; ///< m/s^2
+};
+
+/// @brief Minimum of -v + sqrt(v^2 - 2ad), i.e. twice the average closing
+/// speed, for an accelerating object to count as approaching.
+constexpr float kApproachingClosingTerm = -2.0f * kApproachingVelocityThreshold;
+
+/// @brief Calculate Time-To-Collision (TTC) with constant relative
+/// acceleration.
+/// Formula: smallest positive root of d + v t + a t^2 / 2 = 0, written
+/// without cancellation as TTC = 2 d / (-v + sqrt(v^2 - 2 a d)). Infinity
+/// if the discriminant is negative (the approach stops before contact) or
+/// the average closing speed d / TTC does not exceed
+/// -kApproachingVelocityThreshold. For a == 0 the result is bit-identical
+/// to computeCollisionTime(distance, relative_velocity).
+/// @param distance Distance in meters.
+/// @param relative_velocity Relative velocity in m/s (negative = approaching).
+/// @param relative_acceleration Relative acceleration in m/s^2 (negative =
+/// closing faster).
+/// @return TTC in seconds.
+inline float computeCollisionTime(float distance, float relative_velocity,
+                                  float relative_acceleration) noexcept {
+  const float discriminant = relative_velocity * relative_velocity -
+                             2.0f * relative_acceleration * distance;
+  const float closing_term =
+      std::sqrt(std::max(discriminant, 0.0f)) - relative_velocity;
+  return (discriminant >= 0.0f && closing_term > kApproachingClosingTerm)
+             ? (distance + distance) / closing_term
+             : std::numeric_limits<float>::infinity();
+}
+
+/// @brief Constant relative acceleration implied by a TTC.
+/// @details Inverts the three-argument computeCollisionTime() for objects
+/// that keep only their TTC: a = -2 (d + v TTC) / TTC^2. A TTC equal to the
+/// constant-velocity TTC gives exactly 0. An infinite TTC of an approaching
+/// object (the approach stops before contact) gives v^2 / d; the
+/// discriminant v^2 - 2 a d = -v^2 is constant over time, so the object is
+/// never predicted to arrive.
+/// @param distance Distance in meters.
+/// @param relative_velocity Relative velocity in m/s (negative = approaching).
+/// @param collision_time TTC in seconds.
+/// @return Relative acceleration in m/s^2.
+inline float impliedRelativeAcceleration(float distance,
+                                         float relative_velocity,
+                                         float collision_time) noexcept {
+  if (collision_time == computeCollisionTime(distance, relative_velocity) ||
+      !(collision_time > 0.0f)) {
+    return 0.0f;
+  }
+  if (std::isinf(collision_time)) {
+    return distance > 0.0f
+               ? relative_velocity * relative_velocity / distance
+               : 0.0f;
+  }
+  return -2.0f * (distance + relative_velocity * collision_time) /
+         (collision_time * collision_time);
+}
+
+/// @brief Calculate threat level based on distance and TTC.
+/// @param distance Distance in meters.
+/// @param collision_time TTC in seconds.
+/// @return Threat level from 0.0 to 1.0.
+constexpr float computeThreatLevel(float distance,
+                                   float collision_time) noexcept {
+  if (collision_time > kIrrelevantCollisionTime)
+    return 0.0f;
+  if (collision_time < kImminentCollisionTime)
+    return 1.0f;
+
+  const float distance_factor =
+      std::max(0.0f, 1.0f - distance / kThreatDistanceRange);
+  const float time_factor =
+      std::max(0.0f, 1.0f - collision_time / kIrrelevantCollisionTime);
+  return (distance_factor + time_factor) / 2.0f;
+}
+
+/// @brief Threshold predicate shared by every collision-time query.
+/// @param collision_time TTC in seconds.
+/// @param threshold_seconds Time threshold in seconds.
+/// @return true if collision_time is finite and <= threshold_seconds.
+inline bool isWithinCollisionTimeThreshold(float collision_time,
+                                           float threshold_seconds) noexcept {
+  return !std::isinf(collision_time) && collision_time <= threshold_seconds;
+}
+
+} // namespace object_tracking
+} // namespace aeb
+
+#endif // AEB_OBJECT_TRACKING_INCLUDE_AEB_COLLISION_MODEL_H
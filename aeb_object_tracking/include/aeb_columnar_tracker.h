@@ -0,0 +1,185 @@
+/// @file aeb_columnar_tracker.h
+/// @brief Structure-of-arrays (SoA) storage backend for AEB object tracking.
+/// @details Defines ColumnarObjectTracker, which keeps every DetectedObject
+/// attribute in its own contiguous column so that scans only stream the data
+/// a query actually reads (e.g. the collision-time column for threshold
+/// queries).
+
+#ifndef AEB_OBJECT_TRACKING_INCLUDE_AEB_COLUMNAR_TRACKER_H
+#define AEB_OBJECT_TRACKING_INCLUDE_AEB_COLUMNAR_TRACKER_H
+
+#include <cstddef>        // for size_t
+#include <limits>         // for numeric_limits
+#include <string>         // for string
+#include <vector>         // for vector
+#include "aeb_threshold_classification.h"  // for ThresholdClassification
+#include "aeb_tracker.h"  // for DetectedObject
+
+namespace aeb {
+namespace object_tracking {
+
+/// @brief AEB Object Tracking System with columnar (SoA) storage.
+/// @details Offers the same query API as AEBObjectTracker, but stores ids,
+/// distances, relative velocities, collision times and threat levels in
+/// separate contiguous columns instead of a vector of DetectedObject records.
+/// Threshold scans only touch the collision-time column, which reduces memory
+/// traffic for large frames. Sorting builds an index permutation from the
+/// columns a comparator needs and gathers every column once.
+///
+/// Objects are materialized as DetectedObject on demand via getObject().
+///
+class ColumnarObjectTracker {
+public:
+  /// @brief Returned by findObjectById() when no object matches.
+  static constexpr std::size_t kNotFound =
+      std::numeric_limits<std::size_t>::max();
+
+  /// @brief Add a detected object to the tracking system.
+  /// @param object DetectedObject to add.
+  void addObject(DetectedObject const &object);
+
+  /// @brief Add a whole frame of raw detections.
+  /// @details Appends the raw columns and computes TTC and threat level for
+  /// the batch with simd::computeCollisionTimes(), instead of constructing a
+  /// DetectedObject per detection.
+  /// @param ids Object identifiers.
+  /// @param distances Distances in meters.
+  /// @param relative_velocities Relative velocities in m/s.
+  /// @param count Number of detections in every array.
+  void addObjects(int const *ids, float const *distances,
+                  float const *relative_velocities, std::size_t count);
+
+  /// @brief Add a whole frame of detections with constant-acceleration TTC.
+  /// @details The velocities are appended to the relative-velocity column
+  /// and turned into ego-compensated relative velocities in place by the
+  /// same kernel pass that computes TTC and threat level. Accelerations are
+  /// not stored.
+  /// @param ids Object identifiers.
+  /// @param distances Distances in meters.
+  /// @param velocities Velocities in m/s, over ground unless ego is at rest.
+  /// @param accelerations Accelerations in m/s^2, same frame as velocities.
+  /// @param count Number of detections in every array.
+  /// @param ego Ego motion subtracted from velocities and accelerations.
+  void addObjects(int const *ids, float const *distances,
+                  float const *velocities, float const *accelerations,
+                  std::size_t count, EgoMotion const &ego = EgoMotion{});
+
+  /// @brief Reserve memory capacity for objects in every column.
+  /// @param capacity Number of objects to reserve space for.
+  void reserveCapacity(std::size_t capacity);
+
+  /// @brief Clear all tracked objects.
+  void clear() noexcept;
+
+  /// @brief Get number of tracked objects.
+  /// @return Number of objects.
+  std::size_t size() const;
+
+  /// @brief Check if tracker is empty.
+  /// @return true if no objects are tracked.
+  bool empty() const;
+
+  /// @brief Materialize the object stored at the given position.
+  /// @param index Position in storage order (must be < size()).
+  /// @return DetectedObject rebuilt from the columns, with the stored TTC
+  /// and threat level (not recomputed).
+  DetectedObject getObject(std::size_t index) const;
+
+  /// @name Column accessors
+  /// @{
+  std::vector<int> const &getIds() const { return ids_; }
+  std::vector<float> const &getDistances() const { return distances_; }
+  std::vector<float> const &getRelativeVelocities() const {
+    return relative_velocities_;
+  }
+  std::vector<float> const &getCollisionTimes() const {
+    return collision_times_;
+  }
+  std::vector<float> const &getThreatLevels() const { return threat_levels_; }
+  /// @}
+
+  /// @brief Sort all objects by collision time (full sort using introsort).
+  /// Ordering matches AEBObjectTracker::Comparators::byCollisionTime.
+  /// Time complexity: O(n log n), Space: O(n) for the permutation.
+  void sortByCollisionTime();
+
+  /// @brief Sort all objects by threat level (full sort using introsort).
+  /// Ordering matches AEBObjectTracker::Comparators::byThreatLevel.
+  /// Time complexity: O(n log n), Space: O(n) for the permutation.
+  void sortByThreatLevel();
+
+  /// @brief Move the n most critical objects by collision time to the front.
+  /// Time complexity: O(n log k) where k = max_objects, Space: O(n).
+  /// @param max_objects Maximum number of critical objects to sort.
+  void partialSortCriticalObjects(std::size_t max_objects);
+
+  /// @brief Multi-criteria sort combining threat level, collision time, and
+  /// distance (same criteria as AEBObjectTracker::sortMultiCriteria).
+  void sortMultiCriteria();
+
+  /// @brief Get the most critical objects (assumes partialSortCriticalObjects
+  /// was called).
+  /// @param max_objects Maximum number of objects to return.
+  /// @return Vector of critical objects.
+  std::vector<DetectedObject>
+  getCriticalObjects(std::size_t max_objects) const;
+
+  /// @brief Get objects within critical collision time threshold.
+  /// @param threshold_seconds Time threshold in seconds.
+  /// @return Vector of objects within threshold.
+  std::vector<DetectedObject>
+  getObjectsWithinTimeThreshold(float threshold_seconds) const;
+
+  /// @brief Get positions of objects within critical collision time
+  /// threshold, using the vectorized compress-store filter.
+  /// @param threshold_seconds Time threshold in seconds.
+  /// @param indices Output positions in ascending order; its capacity is
+  /// reused between calls.
+  /// @return Number of objects within threshold.
+  std::size_t
+  getObjectIndicesWithinTimeThreshold(float threshold_seconds,
+                                      std::vector<std::size_t> &indices) const;
+
+  /// @brief Find object by ID.
+  /// @param id Object ID to search for.
+  /// @return Position of the first matching object or kNotFound.
+  std::size_t findObjectById(int id) const noexcept;
+
+  /// @brief Check if any object has critical collision time.
+  /// @param threshold_seconds Critical time threshold in seconds.
+  /// @return true if any object is within critical threshold.
+  bool hasCriticalObjects(float threshold_seconds) const;
+
+  /// @brief Classify all objects into TTC threshold bands in a single pass
+  /// over the collision-time column.
+  /// @param thresholds TTC band upper bounds in seconds, sorted ascending.
+  /// @param classification Result; its allocated capacity is reused.
+  /// @param collect_indices Whether to record per-band index lists.
+  void classifyByThresholds(std::vector<float> const &thresholds,
+                            ThresholdClassification &classification,
+                            bool collect_indices = false) const;
+
+  /// @brief Print objects for debugging.
+  /// @param title Optional title for the output.
+  void printObjects(std::string const &title = "") const;
+
+private:
+  std::vector<int> ids_;                   ///< Object identifiers
+  std::vector<float> distances_;           ///< meters
+  std::vector<float> relative_velocities_; ///< m/s (negative = approaching)
+  std::vector<float> collision_times_;     ///< seconds (calculated TTC)
+  std::vector<float> threat_levels_;       ///< 0.0 to 1.0
+
+  std::vector<std::size_t> permutation_; ///< Scratch for sorting
+  std::vector<float> float_scratch_;     ///< Scratch for gathering columns
+  std::vector<int> id_scratch_;          ///< Scratch for gathering ids
+
+  /// @brief Reorder every column so that position i holds the object that
+  /// was previously stored at permutation_[i].
+  void applyPermutation();
+};
+
+} // namespace object_tracking
+} // namespace aeb
+
+#endif // AEB_OBJECT_TRACKING_INCLUDE_AEB_COLUMNAR_TRACKER_H
@@ -0,0 +1,171 @@
+/// @file aeb_compact_object.h
+/// @brief 8-byte fixed-point representation of a detected object.
+/// @details DetectedObject takes 20 bytes (an int and four floats, two of
+/// them derived). CompactObject stores the same information in 8 bytes so
+/// that 2.5x more objects fit in L1/L2 while sorting and scanning large
+/// frames. Convert at ingest, sort and filter compact records, and convert
+/// back only the few objects that are acted upon.
+
+#ifndef AEB_OBJECT_TRACKING_INCLUDE_AEB_COMPACT_OBJECT_H
+#define AEB_OBJECT_TRACKING_INCLUDE_AEB_COMPACT_OBJECT_H
+
+#include <cassert>                // for assert
+#include <cstdint>                // for uint16_t, int16_t, uint32_t
+#include <limits>                 // for numeric_limits
+#include "aeb_collision_model.h"  // for computeCollisionTime, computeThre...
+#include "aeb_detected_object.h"  // for DetectedObject
+
+namespace aeb {
+namespace object_tracking {
+
+/// @brief Quantized detected object.
+/// @details Layout and resolution:
+/// - id: 16 bits; track IDs must lie in [0, kMaxId]. Larger IDs (e.g. from
+///   a long ScenarioGenerator run) would wrap and collide, so they are
+///   rejected by a debug assertion; recycle IDs before converting.
+/// - distance: signed centimeters, +/-327.67 m (saturating).
+/// - relative velocity: signed cm/s, +/-327.67 m/s (saturating).
+/// - TTC: milliseconds up to 65.533 s; longer TTCs saturate to
+///   kSaturatedTime, infinite TTC is kInfiniteTime.
+/// The threat level is not stored; it is derived on access from the
+/// quantized distance and TTC, so it may differ from the float pipeline in
+/// the last digits.
+///
+class CompactObject {
+public:
+  /// @brief Quantized TTC of objects that are not approaching.
+  static constexpr std::uint16_t kInfiniteTime = 0xFFFFU;
+  /// @brief Quantized TTC of objects approaching slower than 65.533 s.
+  static constexpr std::uint16_t kSaturatedTime = 0xFFFEU;
+  /// @brief Largest representable object ID.
+  static constexpr int kMaxId = 0xFFFF;
+
+  constexpr CompactObject() noexcept = default;
+
+  /// @brief Quantize a measurement; the TTC is computed from the full
+  /// precision inputs before quantization.
+  /// @param id Object ID in [0, kMaxId].
+  /// @param distance Distance in meters.
+  /// @param relative_velocity Relative velocity in m/s.
+  constexpr CompactObject(int id, float distance,
+                          float relative_velocity) noexcept
+      : CompactObject(id, distance, relative_velocity,
+                      computeCollisionTime(distance, relative_velocity)) {}
+
+  /// @brief Quantize a full object, keeping its TTC as computed (e.g. with
+  /// constant acceleration) rather than recomputing it.
+  static constexpr CompactObject
+  fromDetectedObject(DetectedObject const &object) noexcept {
+    return CompactObject(object.getId(), object.getDistance(),
+                         object.getRelativeVelocity(),
+                         object.getCollisionTime());
+  }
+
+  /// @brief Rebuild a full object from the quantized record, with the
+  /// quantized TTC (a saturated TTC comes back as 65.534 s) and the derived
+  /// threat level.
+  constexpr DetectedObject toDetectedObject() const noexcept {
+    return DetectedObject::fromPrecomputed(getId(), getDistance(),
+                                           getRelativeVelocity(),
+                                           getCollisionTime(),
+                                           getThreatLevel());
+  }
+
+  constexpr int getId() const noexcept { return id_; }
+  constexpr float getDistance() const noexcept {
+    return static_cast<float>(distance_cm_) / kCentimetersPerMeter;
+  }
+  constexpr float getRelativeVelocity() const noexcept {
+    return static_cast<float>(velocity_cm_s_) / kCentimetersPerMeter;
+  }
+  /// @brief TTC in seconds; infinity for objects that are not approaching.
+  constexpr float getCollisionTime() const noexcept {
+    return collision_time_ms_ == kInfiniteTime
+               ? std::numeric_limits<float>::infinity()
+               : static_cast<float>(collision_time_ms_) /
+                     kMillisecondsPerSecond;
+  }
+  /// @brief Threat level derived from the quantized distance and TTC.
+  constexpr float getThreatLevel() const noexcept {
+    return computeThreatLevel(getDistance(), getCollisionTime());
+  }
+
+  /// @brief Quantized TTC in milliseconds (or kSaturatedTime /
+  /// kInfiniteTime).
+  constexpr std::uint16_t getCollisionTimeCode() const noexcept {
+    return collision_time_ms_;
+  }
+
+  /// @brief Integer key ordering by TTC, then distance: ascending order is
+  /// most to least critical, as AEBObjectTracker::Comparators::
+  /// byCollisionTime up to quantization.
+  constexpr std::uint32_t sortKey() const noexcept {
+    // Bias the signed distance so that the unsigned key keeps its order.
+    const auto distance_bits =
+        static_cast<std::uint16_t>(static_cast<std::uint16_t>(distance_cm_) ^
+                                   0x8000U);
+    return (std::uint32_t{collision_time_ms_} << 16U) | distance_bits;
+  }
+
+  /// @brief Comparator on sortKey().
+  static constexpr bool byCollisionTime(CompactObject const &first_object,
+                                        CompactObject const &second_object)
+      noexcept {
+    return first_object.sortKey() < second_object.sortKey();
+  }
+
+private:
+  static constexpr float kCentimetersPerMeter = 100.0f;
+  static constexpr float kMillisecondsPerSecond = 1000.0f;
+
+  std::uint16_t id_{0U};
+  std::int16_t distance_cm_{0};
+  std::int16_t velocity_cm_s_{0};
+  std::uint16_t collision_time_ms_{kInfiniteTime};
+
+  constexpr CompactObject(int id, float distance, float relative_velocity,
+                          float collision_time) noexcept
+      : id_{static_cast<std::uint16_t>(id)},
+        distance_cm_{toCentimeters(distance)},
+        velocity_cm_s_{toCentimeters(relative_velocity)},
+        collision_time_ms_{toMilliseconds(collision_time)} {
+    assert(id >= 0 && id <= kMaxId && "object ID does not fit in 16 bits");
+  }
+
+  /// @brief Round to the nearest centimeter, saturating at the int16 range.
+  static constexpr std::int16_t toCentimeters(float meters) noexcept {
+    constexpr float kLimit = 32767.0f;
+    const float centimeters = meters * kCentimetersPerMeter;
+    if (!(centimeters > -kLimit)) { // also maps NaN to the lower bound
+      return static_cast<std::int16_t>(-32767);
+    }
+    if (centimeters > kLimit) {
+      return static_cast<std::int16_t>(32767);
+    }
+    return static_cast<std::int16_t>(centimeters < 0.0f ? centimeters - 0.5f
+                                                        : centimeters + 0.5f);
+  }
+
+  /// @brief Round a TTC to milliseconds, saturating below kSaturatedTime.
+  static constexpr std::uint16_t toMilliseconds(float seconds) noexcept {
+    if (seconds == std::numeric_limits<float>::infinity()) {
+      return kInfiniteTime;
+    }
+    const float milliseconds = seconds * kMillisecondsPerSecond + 0.5f;
+    if (!(milliseconds >= 0.0f)) {
+      return 0U;
+    }
+    if (milliseconds >= static_cast<float>(kSaturatedTime)) {
+      return kSaturatedTime;
+    }
+    return static_cast<std::uint16_t>(milliseconds);
+  }
+};
+
+static_assert(sizeof(CompactObject) == 8U,
+              "CompactObject must stay an 8-byte record");
+
+} // namespace object_tracking
+} // namespace aeb
+
+#endif // AEB_OBJECT_TRACKING_INCLUDE_AEB_COMPACT_OBJECT_H
@@ -0,0 +1,72 @@
+/// @file aeb_critical_object_set.h
+/// @brief Bounded set of the K most critical objects by collision time.
+/// @details Maintained incrementally on insert so that the top-K is always
+/// available in O(K) without re-sorting the whole frame.
+
+#ifndef AEB_OBJECT_TRACKING_INCLUDE_AEB_CRITICAL_OBJECT_SET_H
+#define AEB_OBJECT_TRACKING_INCLUDE_AEB_CRITICAL_OBJECT_SET_H
+
+#include <cstddef>                // for size_t
+#include <memory_resource>        // for memory_resource, vector
+#include "aeb_detected_object.h"  // for DetectedObject, ObjectRange
+
+namespace aeb {
+namespace object_tracking {
+
+/// @brief Small sorted array holding the K most critical objects ordered by
+/// AEBObjectTracker::Comparators::byCollisionTime.
+/// @details For the K in the planner's range (3-10) a sorted array beats a
+/// heap: insertion is a short memmove and the contents are always readable
+/// in order. Storage is reserved once when the capacity is set.
+///
+class CriticalObjectSet {
+public:
+  /// @brief Create a set holding up to capacity objects.
+  /// @param capacity Maximum number of objects (K).
+  /// @param resource Memory resource for the object storage.
+  explicit CriticalObjectSet(
+      std::size_t capacity = 0U,
+      std::pmr::memory_resource *resource = std::pmr::get_default_resource());
+
+  /// @brief Change the maximum number of objects; clears the set.
+  /// @param capacity Maximum number of objects (K).
+  void setCapacity(std::size_t capacity);
+
+  /// @brief Offer an object to the set. Time complexity: O(K).
+  /// @param object Candidate object.
+  /// @return true if the object is now among the K most critical.
+  bool offer(DetectedObject const &object);
+
+  /// @brief Check if offer() would accept the object, without inserting it.
+  /// @param object Candidate object.
+  /// @return true if the object is more critical than the current K-th one
+  /// or the set is not full.
+  bool admits(DetectedObject const &object) const;
+
+  /// @brief Remove the object with the given ID.
+  /// @param id Object ID.
+  /// @return true if an object was removed.
+  bool remove(int id);
+
+  /// @brief Remove all objects, keeping the capacity.
+  void clear() noexcept { objects_.clear(); }
+
+  /// @brief Objects ordered from most to least critical.
+  ObjectRange objects() const noexcept {
+    return ObjectRange(objects_.data(), objects_.size());
+  }
+
+  std::size_t size() const noexcept { return objects_.size(); }
+  std::size_t capacity() const noexcept { return capacity_; }
+  bool empty() const noexcept { return objects_.empty(); }
+  bool full() const noexcept { return objects_.size() >= capacity_; }
+
+private:
+  std::pmr::vector<DetectedObject> objects_;
+  std::size_t capacity_{0U};
+};
+
+} // namespace object_tracking
+} // namespace aeb
+
+#endif // AEB_OBJECT_TRACKING_INCLUDE_AEB_CRITICAL_OBJECT_SET_H
@@ -0,0 +1,190 @@
+/// @file aeb_detected_object.h
+/// @brief Detected object record and non-owning views over object storage.
+/// @details Defines DetectedObject together with ObjectRange and
+/// ThresholdObjectRange, the allocation-free views returned by the trackers.
+
+#ifndef AEB_OBJECT_TRACKING_INCLUDE_AEB_DETECTED_OBJECT_H
+#define AEB_OBJECT_TRACKING_INCLUDE_AEB_DETECTED_OBJECT_H
+
+#include <cstddef>   // for size_t, ptrdiff_t
+#include <iterator>  // for forward_iterator_tag, distance
+#include "aeb_collision_model.h"  // for computeCollisionTime, isWithinColl...
+
+namespace aeb {
+namespace object_tracking {
+
+/// @brief Detected objects for Autonomous Emergency Braking and Collision
+/// Warning Systems (AEB/CW).
+/// @details This class represents an object detected by AEB tracking system,
+/// encapsulating its unique identifier, distance, relative velocity, estimated
+/// collision time, and calculated threat level.
+///
+/// The threat level is computed based on object dynamics and is used to assess
+/// collision risk.
+///
+class DetectedObject {
+public:
+  // Constructors
+  DetectedObject(int obj_id, float dist, float rel_vel) noexcept;
+  /// @brief Object with constant-acceleration TTC (see the three-argument
+  /// computeCollisionTime()). The acceleration itself is not stored.
+  DetectedObject(int obj_id, float dist, float rel_vel,
+                 float rel_accel) noexcept;
+  /// @brief Object 0 at distance 0, not approaching; usable in constant
+  /// expressions, e.g. to value-initialize fixed-capacity storage.
+  constexpr DetectedObject() noexcept
+      : DetectedObject(0, 0.0f, 0.0f, computeCollisionTime(0.0f, 0.0f),
+                       computeThreatLevel(0.0f,
+                                          computeCollisionTime(0.0f, 0.0f))) {}
+
+  /// @brief Object whose TTC and threat level were computed in a batch,
+  /// e.g. by simd::computeCollisionTimes(); nothing is recomputed.
+  static constexpr DetectedObject
+  fromPrecomputed(int obj_id, float dist, float rel_vel, float collision_time,
+                  float threat_level) noexcept {
+    return DetectedObject(obj_id, dist, rel_vel, collision_time, threat_level);
+  }
+
+  // Getters
+  constexpr int getId() const { return id_; }
+  constexpr float getDistance() const { return distance_; }
+  constexpr float getRelativeVelocity() const { return relative_velocity_; }
+  constexpr float getCollisionTime() const { return collision_time_; }
+  constexpr float getThreatLevel() const { return threat_level_; }
+
+  // Comparison operators for sorting
+  bool operator<(const DetectedObject &other) const noexcept;
+  bool operator==(const DetectedObject &other) const noexcept;
+
+private:
+  int id_;
+  float distance_;          // meters
+  float relative_velocity_; // m/s (negative = approaching)
+  float collision_time_;    // seconds (calculated TTC)
+  float threat_level_;      // 0.0 to 1.0
+
+  constexpr DetectedObject(int obj_id, float dist, float rel_vel,
+                           float collision_time, float threat_level) noexcept
+      : id_{obj_id}, distance_{dist}, relative_velocity_{rel_vel},
+        collision_time_{collision_time}, threat_level_{threat_level} {}
+
+  constexpr float calculateThreatLevel() const noexcept;
+};
+
+/// @brief Non-owning view over contiguous DetectedObject records.
+/// @details C++17 stand-in for std::span<const DetectedObject>. A view is
+/// invalidated by any operation that reallocates or reorders the storage it
+/// refers to.
+///
+class ObjectRange {
+public:
+  using value_type = DetectedObject;
+  using const_iterator = DetectedObject const *;
+  using iterator = const_iterator;
+
+  constexpr ObjectRange() noexcept = default;
+  constexpr ObjectRange(DetectedObject const *data, std::size_t size) noexcept
+      : data_{data}, size_{size} {}
+
+  constexpr const_iterator begin() const noexcept { return data_; }
+  constexpr const_iterator end() const noexcept { return data_ + size_; }
+  constexpr DetectedObject const *data() const noexcept { return data_; }
+  constexpr std::size_t size() const noexcept { return size_; }
+  constexpr bool empty() const noexcept { return size_ == 0U; }
+  constexpr DetectedObject const &operator[](std::size_t index) const {
+    return data_[index];
+  }
+
+private:
+  DetectedObject const *data_{nullptr};
+  std::size_t size_{0U};
+};
+
+/// @brief Lazy view over the objects of a range whose collision time is
+/// within a threshold.
+/// @details Matches are found while iterating; nothing is copied or
+/// allocated. Same invalidation rules as ObjectRange.
+///
+class ThresholdObjectRange {
+public:
+  /// @brief Forward iterator skipping objects outside the threshold.
+  class const_iterator {
+  public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = DetectedObject;
+    using difference_type = std::ptrdiff_t;
+    using pointer = DetectedObject const *;
+    using reference = DetectedObject const &;
+
+    const_iterator() noexcept = default;
+    const_iterator(DetectedObject const *current, DetectedObject const *last,
+                   float threshold_seconds) noexcept
+        : current_{current}, last_{last},
+          threshold_seconds_{threshold_seconds} {
+      skipNonMatching();
+    }
+
+    reference operator*() const { return *current_; }
+    pointer operator->() const { return current_; }
+
+    const_iterator &operator++() noexcept {
+      ++current_;
+      skipNonMatching();
+      return *this;
+    }
+    const_iterator operator++(int) noexcept {
+      const_iterator previous = *this;
+      ++*this;
+      return previous;
+    }
+
+    bool operator==(const_iterator const &other) const noexcept {
+      return current_ == other.current_;
+    }
+    bool operator!=(const_iterator const &other) const noexcept {
+      return current_ != other.current_;
+    }
+
+  private:
+    DetectedObject const *current_{nullptr};
+    DetectedObject const *last_{nullptr};
+    float threshold_seconds_{0.0f};
+
+    void skipNonMatching() noexcept {
+      while (current_ != last_ &&
+             !isWithinCollisionTimeThreshold(current_->getCollisionTime(),
+                                             threshold_seconds_)) {
+        ++current_;
+      }
+    }
+  };
+  using iterator = const_iterator;
+
+  ThresholdObjectRange(ObjectRange objects, float threshold_seconds) noexcept
+      : objects_{objects}, threshold_seconds_{threshold_seconds} {}
+
+  const_iterator begin() const noexcept {
+    return const_iterator(objects_.begin(), objects_.end(),
+                          threshold_seconds_);
+  }
+  const_iterator end() const noexcept {
+    return const_iterator(objects_.end(), objects_.end(), threshold_seconds_);
+  }
+
+  /// @brief Check if the view contains no object (stops at the first match).
+  bool empty() const noexcept { return begin() == end(); }
+
+  /// @brief Count the matching objects. Time complexity: O(n).
+  std::size_t count() const noexcept {
+    return static_cast<std::size_t>(std::distance(begin(), end()));
+  }
+
+private:
+  ObjectRange objects_;
+  float threshold_seconds_;
+};
+
+} // namespace object_tracking
+} // namespace aeb
+
+#endif // AEB_OBJECT_TRACKING_INCLUDE_AEB_DETECTED_OBJECT_H
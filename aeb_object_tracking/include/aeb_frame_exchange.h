@@ -0,0 +1,101 @@
+/// @file aeb_frame_exchange.h
+/// @brief Lock-free handoff of tracker frames from a sensor thread to a
+/// planner thread.
+/// @details AEBObjectTracker itself is not thread-safe. TrackerFrameExchange
+/// owns three trackers (a triple buffer): the producer fills and sorts the
+/// back frame, publish() swaps it with the shared middle slot, and the
+/// consumer's acquire() swaps the middle slot with its front frame. Neither
+/// side ever waits for the other, and a frame is never modified while the
+/// consumer holds it.
+
+#ifndef AEB_OBJECT_TRACKING_INCLUDE_AEB_FRAME_EXCHANGE_H
+#define AEB_OBJECT_TRACKING_INCLUDE_AEB_FRAME_EXCHANGE_H
+
+#include <array>            // for array
+#include <atomic>           // for atomic
+#include <cstddef>          // for size_t
+#include <cstdint>          // for uint8_t, uint64_t
+#include <memory_resource>  // for memory_resource, get_default_resource
+#include "aeb_tracker.h"    // for AEBObjectTracker
+
+namespace aeb {
+namespace object_tracking {
+
+/// @brief Single-producer/single-consumer triple buffer of tracker frames.
+/// @details Producer side (one thread): writeFrame(), publish().
+/// Consumer side (one thread): acquire(), readFrame(), readSequence().
+/// The slot ownership is passed with one atomic exchange per call; all
+/// other state is owned by exactly one side and kept on separate cache
+/// lines. A consumer that falls behind skips frames and always reads the
+/// most recently published one.
+///
+/// Configure and size the three frames with forEachFrame() before the
+/// threads start; afterwards each frame is only touched by its current
+/// owner.
+///
+class TrackerFrameExchange {
+public:
+  /// @brief Create the three frames allocating from resource.
+  /// @param resource Memory resource; must outlive the exchange.
+  explicit TrackerFrameExchange(
+      std::pmr::memory_resource *resource = std::pmr::get_default_resource());
+
+  TrackerFrameExchange(TrackerFrameExchange const &) = delete;
+  TrackerFrameExchange &operator=(TrackerFrameExchange const &) = delete;
+
+  /// @brief Apply a setup function (reserveCapacity, enableIdIndex,
+  /// setSortMode, ...) to all three frames. Not thread-safe: call before
+  /// the producer and consumer start.
+  /// @param setup Callable taking AEBObjectTracker&.
+  template <typename Setup> void forEachFrame(Setup &&setup) {
+    for (auto &frame : frames_) {
+      setup(frame);
+    }
+  }
+
+  /// @brief Producer: the frame being built. It holds whatever the slot
+  /// contained before (an older frame), so clear() it first.
+  AEBObjectTracker &writeFrame() noexcept { return frames_[back_]; }
+
+  /// @brief Producer: make the frame being built visible to the consumer
+  /// and take over a free slot for the next one.
+  /// @return Sequence number of the published frame (1 for the first).
+  std::uint64_t publish() noexcept;
+
+  /// @brief Consumer: switch to the latest published frame, if any.
+  /// @return true if a frame newer than the current one was acquired.
+  bool acquire() noexcept;
+
+  /// @brief Consumer: the acquired frame. Stays unchanged until the next
+  /// acquire(); empty before the first one.
+  AEBObjectTracker const &readFrame() const noexcept {
+    return frames_[front_];
+  }
+
+  /// @brief Consumer: sequence number of the acquired frame (0 before the
+  /// first acquire). Gaps mean that frames were skipped.
+  std::uint64_t readSequence() const noexcept { return sequences_[front_]; }
+
+private:
+  /// @brief The middle slot stores its index and a "not yet acquired" flag.
+  static constexpr std::uint8_t kIndexMask = 0x03U;
+  static constexpr std::uint8_t kFreshFlag = 0x04U;
+  static constexpr std::size_t kCacheLineSize = 64U;
+
+  std::array<AEBObjectTracker, 3U> frames_;
+  std::array<std::uint64_t, 3U> sequences_{};
+
+  alignas(kCacheLineSize) std::atomic<std::uint8_t> middle_{1U};
+
+  // Producer-owned.
+  alignas(kCacheLineSize) std::uint8_t back_{0U};
+  std::uint64_t published_{0U};
+
+  // Consumer-owned.
+  alignas(kCacheLineSize) std::uint8_t front_{2U};
+};
+
+} // namespace object_tracking
+} // namespace aeb
+
+#endif // AEB_OBJECT_TRACKING_INCLUDE_AEB_FRAME_EXCHANGE_H
@@ -0,0 +1,171 @@
+/// @file aeb_frame_log.h
+/// @brief Binary recording of tracker input and memory-mapped replay.
+/// @details Captures what the tracker saw in the field so that performance
+/// issues can be reproduced offline. The format is a flat sequence of
+/// fixed-size records that the reader uses in place, without parsing or
+/// copying, so replaying long drives is I/O bound.
+///
+/// Layout (host byte order, i.e. little-endian on every supported target;
+/// every record 4-byte aligned):
+/// - File header, 16 bytes: magic "AEBFLOG" + NUL, uint32 version (2),
+///   uint32 object record size (16).
+/// - Per frame: frame header, 16 bytes: uint64 timestamp in nanoseconds,
+///   uint32 object count, uint32 reserved (0); followed by count object
+///   records of 16 bytes: int32 id, float32 distance [m], float32 relative
+///   velocity [m/s], float32 TTC [s].
+/// The TTC is stored because it depends on the model it was computed with
+/// (e.g. constant acceleration in AEBObjectTracker::addObjects()), which
+/// the record cannot reproduce; the threat level follows from distance and
+/// TTC and is recomputed on replay. Version 1 logs (without TTC) are
+/// rejected.
+
+#ifndef AEB_OBJECT_TRACKING_INCLUDE_AEB_FRAME_LOG_H
+#define AEB_OBJECT_TRACKING_INCLUDE_AEB_FRAME_LOG_H
+
+#include <cstddef>               // for size_t
+#include <cstdint>               // for uint32_t, uint64_t, int32_t
+#include <fstream>               // for ofstream
+#include <string>                // for string
+#include <vector>                // for vector
+#include "aeb_detected_object.h" // for DetectedObject, ObjectRange
+
+namespace aeb {
+namespace object_tracking {
+
+class AEBObjectTracker;
+
+/// @brief One object record of the log, as stored on disk.
+struct LoggedObject {
+  std::int32_t id;
+  float distance;
+  float relative_velocity;
+  float collision_time;
+
+  /// @brief Record of an object, keeping its TTC as computed.
+  static LoggedObject
+  fromDetectedObject(DetectedObject const &object) noexcept {
+    return LoggedObject{object.getId(), object.getDistance(),
+                        object.getRelativeVelocity(),
+                        object.getCollisionTime()};
+  }
+
+  /// @brief Rebuild the DetectedObject with the recorded TTC (recomputes
+  /// only the threat level).
+  DetectedObject toDetectedObject() const noexcept {
+    return DetectedObject::fromPrecomputed(
+        id, distance, relative_velocity, collision_time,
+        computeThreatLevel(distance, collision_time));
+  }
+};
+
+static_assert(sizeof(LoggedObject) == 16U, "Object records are 16 bytes");
+
+/// @brief One recorded frame; objects point into the mapped file.
+struct LoggedFrame {
+  std::uint64_t timestamp_ns{0U};
+  LoggedObject const *objects{nullptr};
+  std::size_t object_count{0U};
+};
+
+/// @brief Writes frames to a log file.
+/// @details Objects are collected with record() and written as one frame
+/// by endFrame(). A tracker the recorder is attached to writes a snapshot
+/// of its contents with AEBObjectTracker::recordFrame(). Writes go through
+/// the stream buffer; nothing is flushed per object.
+///
+class FrameRecorder {
+public:
+  /// @brief Create or truncate the log file and write its header.
+  /// @param path File to write.
+  explicit FrameRecorder(std::string const &path);
+
+  FrameRecorder(FrameRecorder const &) = delete;
+  FrameRecorder &operator=(FrameRecorder const &) = delete;
+
+  /// @brief Whether the file was opened and every write succeeded.
+  bool good() const { return static_cast<bool>(file_); }
+
+  /// @brief Add an object to the current frame.
+  void record(DetectedObject const &object);
+
+  /// @brief Add objects to the current frame.
+  void record(ObjectRange objects);
+
+  /// @brief Write the current frame and start the next one.
+  /// @param timestamp_ns Frame timestamp in nanoseconds.
+  void endFrame(std::uint64_t timestamp_ns);
+
+  /// @brief Add objects and write the current frame, e.g. a snapshot of
+  /// the tracker contents.
+  /// @param objects Objects to append to the frame.
+  /// @param timestamp_ns Frame timestamp in nanoseconds.
+  void endFrame(ObjectRange objects, std::uint64_t timestamp_ns);
+
+  /// @brief Number of frames written.
+  std::size_t frameCount() const noexcept { return frames_; }
+
+  /// @brief Flush buffered frames to the file.
+  void flush() { file_.flush(); }
+
+private:
+  std::ofstream file_;
+  std::vector<LoggedObject> pending_;
+  std::size_t frames_{0U};
+};
+
+/// @brief Read-only view of a log file, memory-mapped on POSIX systems.
+/// @details open() validates the header and indexes the frame headers (one
+/// pass over 16 bytes per frame); the object records are never touched
+/// until they are used. A frame cut off at the end of the file (e.g. the
+/// recorder did not shut down cleanly) is ignored. On other platforms the
+/// file is read into memory once.
+///
+class FrameLogReader {
+public:
+  FrameLogReader() = default;
+  ~FrameLogReader();
+
+  FrameLogReader(FrameLogReader const &) = delete;
+  FrameLogReader &operator=(FrameLogReader const &) = delete;
+
+  /// @brief Map a log file, replacing any previously opened one.
+  /// @param path File to read.
+  /// @return false if the file cannot be read or is not a version 2 log.
+  bool open(std::string const &path);
+
+  /// @brief Unmap the file. Frames obtained before become invalid.
+  void close() noexcept;
+
+  bool isOpen() const noexcept { return data_ != nullptr; }
+
+  /// @brief Number of complete frames in the file.
+  std::size_t frameCount() const noexcept { return frame_offsets_.size(); }
+
+  /// @brief Total number of object records in the complete frames.
+  std::size_t objectCount() const noexcept { return object_count_; }
+
+  /// @brief Frame by position, pointing into the mapping.
+  /// @param index Frame index in [0, frameCount()).
+  LoggedFrame frame(std::size_t index) const noexcept;
+
+private:
+  unsigned char const *data_{nullptr};
+  std::size_t size_{0U};
+  bool mapped_{false};                   ///< mmap'ed, else owned_ holds data
+  std::vector<unsigned char> owned_;     ///< Fallback copy of the file
+  std::vector<std::size_t> frame_offsets_;
+  std::size_t object_count_{0U};
+
+  /// @brief Validate the header and build the frame index.
+  bool index();
+};
+
+/// @brief Replace the tracker contents with a recorded frame.
+/// @param frame Frame from FrameLogReader::frame().
+/// @param tracker Tracker to load.
+void loadLoggedFrame(LoggedFrame const &frame, AEBObjectTracker &tracker);
+
+} // namespace object_tracking
+} // namespace aeb
+
+#endif // AEB_OBJECT_TRACKING_INCLUDE_AEB_FRAME_LOG_H
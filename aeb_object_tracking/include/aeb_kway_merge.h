@@ -0,0 +1,140 @@
+/// @file aeb_kway_merge.h
+/// @brief Loser-tree k-way merge of sorted object runs.
+/// @details Sensor front-ends deliver their object lists already sorted (or
+/// cheap to sort). Merging k sorted runs of n objects in total costs
+/// O(n log k) comparisons instead of the O(n log n) of sorting the
+/// concatenation, and merging only the first K objects costs
+/// O(k + K log k), independent of n.
+
+#ifndef AEB_OBJECT_TRACKING_INCLUDE_AEB_KWAY_MERGE_H
+#define AEB_OBJECT_TRACKING_INCLUDE_AEB_KWAY_MERGE_H
+
+#include <cstddef>               // for size_t
+#include <memory_resource>       // for memory_resource, get_default_resource
+#include <utility>               // for swap
+#include <vector>                // for vector
+#include "aeb_detected_object.h" // for DetectedObject, ObjectRange
+
+namespace aeb {
+namespace object_tracking {
+
+/// @brief Tournament (loser) tree over up to k sorted runs.
+/// @details Each internal node keeps the loser of the match below it, so
+/// replacing the winner replays a single leaf-to-root path: one comparison
+/// per level, ceil(log2 k) per output object. Ties go to the run with the
+/// lower index, so the merge is stable across runs. Storage is reused
+/// between merges and only grows when more runs are merged than before.
+///
+class KWayMerger {
+public:
+  /// @param resource Memory resource for the tree and the run table.
+  explicit KWayMerger(
+      std::pmr::memory_resource *resource = std::pmr::get_default_resource());
+
+  /// @brief Size the storage for run_count runs ahead of time.
+  void reserve(std::size_t run_count);
+
+  /// @brief Start a new merge over run_count runs, all empty.
+  void reset(std::size_t run_count);
+
+  /// @brief Set run index of the merge started by reset().
+  /// @param index Run index in [0, run_count).
+  /// @param run Objects sorted by the comparator passed to merge().
+  void setRun(std::size_t index, ObjectRange run) noexcept {
+    runs_[index] = run;
+    cursors_[index] = 0U;
+  }
+
+  /// @brief Merge the runs given to reset()/setRun().
+  /// @param max_objects Stop after this many objects (top-K merge).
+  /// @param comp Strict weak ordering every run is sorted by.
+  /// @param output Callable receiving each DetectedObject in merged order.
+  /// @return Number of objects passed to output.
+  template <typename Compare, typename Output>
+  std::size_t merge(std::size_t max_objects, Compare comp, Output output);
+
+  /// @brief reset(), setRun() for every run, then merge().
+  template <typename Compare, typename Output>
+  std::size_t merge(ObjectRange const *runs, std::size_t run_count,
+                    std::size_t max_objects, Compare comp, Output output) {
+    reset(run_count);
+    for (std::size_t r = 0; r < run_count; ++r) {
+      setRun(r, runs[r]);
+    }
+    return merge(max_objects, comp, output);
+  }
+
+private:
+  std::pmr::vector<ObjectRange> runs_;
+  std::pmr::vector<std::size_t> cursors_;
+  std::pmr::vector<std::size_t> losers_; ///< [0] winner, [1, leaves) losers
+  std::size_t leaves_{0U};               ///< run count rounded up to 2^n
+
+  bool exhausted(std::size_t run) const noexcept {
+    return run >= runs_.size() || cursors_[run] == runs_[run].size();
+  }
+
+  DetectedObject const &head(std::size_t run) const noexcept {
+    return runs_[run][cursors_[run]];
+  }
+
+  /// @brief Whether run a's head is output before run b's head.
+  template <typename Compare>
+  bool beats(std::size_t a, std::size_t b, Compare &comp) const {
+    if (exhausted(a)) {
+      return false;
+    }
+    if (exhausted(b)) {
+      return true;
+    }
+    if (comp(head(a), head(b))) {
+      return true;
+    }
+    return !comp(head(b), head(a)) && a < b;
+  }
+
+  /// @brief Play the matches of the subtree at node; return its winner.
+  template <typename Compare>
+  std::size_t build(std::size_t node, Compare &comp) {
+    if (node >= leaves_) {
+      return node - leaves_;
+    }
+    const std::size_t left = build(2U * node, comp);
+    const std::size_t right = build(2U * node + 1U, comp);
+    if (beats(left, right, comp)) {
+      losers_[node] = right;
+      return left;
+    }
+    losers_[node] = left;
+    return right;
+  }
+};
+
+template <typename Compare, typename Output>
+std::size_t KWayMerger::merge(std::size_t max_objects, Compare comp,
+                              Output output) {
+  if (runs_.empty() || max_objects == 0U) {
+    return 0U;
+  }
+  losers_[0] = build(1U, comp);
+
+  std::size_t merged = 0U;
+  while (merged < max_objects && !exhausted(losers_[0])) {
+    std::size_t winner = losers_[0];
+    output(head(winner));
+    ++cursors_[winner];
+    ++merged;
+    for (std::size_t node = (leaves_ + winner) / 2U; node > 0U; node /= 2U) {
+      if (beats(losers_[node], winner, comp)) {
+        std::swap(losers_[node], winner);
+      }
+    }
+    losers_[0] = winner;
+  }
+  return merged;
+}
+
+} // namespace object_tracking
+} // namespace aeb
+
+#endif // AEB_OBJECT_TRACKING_INCLUDE_AEB_KWAY_MERGE_H
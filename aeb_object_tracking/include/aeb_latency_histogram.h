@@ -0,0 +1,138 @@
+/// @file aeb_latency_histogram.h
+/// @brief HDR-style latency histogram and compile-time switchable timers.
+/// @details Records per-frame latencies of the tracker cycle (ingest ->
+/// partial sort -> critical-object decision) so that tail percentiles
+/// (p99, p99.9) can be reported instead of single samples. The timers are
+/// compiled in only with AEB_ENABLE_LATENCY_INSTRUMENTATION; otherwise
+/// AEB_LATENCY_SCOPE expands to nothing and production builds pay nothing.
+
+#ifndef AEB_OBJECT_TRACKING_INCLUDE_AEB_LATENCY_HISTOGRAM_H
+#define AEB_OBJECT_TRACKING_INCLUDE_AEB_LATENCY_HISTOGRAM_H
+
+#include <chrono>   // for steady_clock, duration_cast, nanoseconds
+#include <cstddef>  // for size_t
+#include <cstdint>  // for uint64_t
+#include <string>   // for string
+#include <vector>   // for vector
+
+namespace aeb {
+namespace object_tracking {
+
+/// @brief Whether AEB_LATENCY_SCOPE records anything in this build.
+#ifdef AEB_ENABLE_LATENCY_INSTRUMENTATION
+constexpr bool kLatencyInstrumentationEnabled = true;
+#else
+constexpr bool kLatencyInstrumentationEnabled = false;
+#endif
+
+/// @brief Log-linear histogram of latencies in nanoseconds.
+/// @details Values below 2^(kPrecisionBits + 1) ns are counted exactly;
+/// above that every power of two is split into 2^kPrecisionBits buckets, so
+/// any recorded value is reported within 1/128 (0.8%) of its true value.
+/// The whole uint64_t range is covered by a fixed table, and record() is a
+/// bit scan plus an increment: no allocation after construction.
+///
+class LatencyHistogram {
+public:
+  /// @brief Sub-bucket resolution per power of two (2^7 = 128 buckets).
+  static constexpr unsigned kPrecisionBits = 7U;
+
+  LatencyHistogram();
+
+  /// @brief Record one latency sample.
+  /// @param nanoseconds Latency in nanoseconds.
+  void record(std::uint64_t nanoseconds) noexcept;
+
+  /// @brief Add all samples of another histogram (e.g. of another thread).
+  void merge(LatencyHistogram const &other) noexcept;
+
+  /// @brief Remove all samples.
+  void reset() noexcept;
+
+  /// @brief Number of recorded samples.
+  std::uint64_t count() const noexcept { return count_; }
+
+  /// @brief Smallest recorded value (exact), 0 when empty.
+  std::uint64_t min() const noexcept { return count_ == 0U ? 0U : min_; }
+
+  /// @brief Largest recorded value (exact), 0 when empty.
+  std::uint64_t max() const noexcept { return max_; }
+
+  /// @brief Arithmetic mean of the recorded values, 0 when empty.
+  double mean() const noexcept;
+
+  /// @brief Value at or below which the given fraction of samples lie.
+  /// @param quantile Fraction in [0, 1], e.g. 0.999 for p99.9.
+  /// @return Upper bound of the bucket holding that sample (never above
+  /// max()), 0 when empty.
+  std::uint64_t valueAtQuantile(double quantile) const noexcept;
+
+  /// @brief Print count, p50/p90/p99/p99.9 and max in microseconds.
+  /// @param title Label of the measured stage.
+  void printSummary(std::string const &title) const;
+
+private:
+  std::vector<std::uint64_t> buckets_;
+  std::uint64_t count_{0U};
+  std::uint64_t min_{0U};
+  std::uint64_t max_{0U};
+  double sum_{0.0};
+};
+
+/// @brief Records the lifetime of the object into a histogram.
+/// @details Use through AEB_LATENCY_SCOPE so that it disappears from
+/// builds without AEB_ENABLE_LATENCY_INSTRUMENTATION.
+///
+class ScopedLatencyTimer {
+public:
+  explicit ScopedLatencyTimer(LatencyHistogram &histogram) noexcept
+      : histogram_{histogram}, start_{std::chrono::steady_clock::now()} {}
+
+  ~ScopedLatencyTimer() {
+    const auto elapsed = std::chrono::steady_clock::now() - start_;
+    histogram_.record(static_cast<std::uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed)
+            .count()));
+  }
+
+  ScopedLatencyTimer(ScopedLatencyTimer const &) = delete;
+  ScopedLatencyTimer &operator=(ScopedLatencyTimer const &) = delete;
+
+private:
+  LatencyHistogram &histogram_;
+  std::chrono::steady_clock::time_point start_;
+};
+
+/// @brief Per-stage latencies of one tracker cycle.
+struct FrameLatencyProfile {
+  LatencyHistogram ingest;   ///< Adding the frame's objects
+  LatencyHistogram sort;     ///< Partial sort of the critical objects
+  LatencyHistogram decision; ///< Critical-object queries
+  LatencyHistogram total;    ///< Whole cycle
+
+  /// @brief Print the summary of every stage.
+  void printReport() const;
+
+  /// @brief Add all samples of another profile (e.g. of another thread).
+  void merge(FrameLatencyProfile const &other) noexcept;
+
+  /// @brief Remove all samples of every stage.
+  void reset() noexcept;
+};
+
+} // namespace object_tracking
+} // namespace aeb
+
+#define AEB_LATENCY_CONCAT_IMPL(a, b) a##b
+#define AEB_LATENCY_CONCAT(a, b) AEB_LATENCY_CONCAT_IMPL(a, b)
+
+/// @brief Time the rest of the enclosing scope into histogram.
+#ifdef AEB_ENABLE_LATENCY_INSTRUMENTATION
+#define AEB_LATENCY_SCOPE(histogram)                                          \
+  ::aeb::object_tracking::ScopedLatencyTimer AEB_LATENCY_CONCAT(              \
+      aeb_latency_timer_, __LINE__)(histogram)
+#else
+#define AEB_LATENCY_SCOPE(histogram) static_cast<void>(0)
+#endif
+
+#endif // AEB_OBJECT_TRACKING_INCLUDE_AEB_LATENCY_HISTOGRAM_H
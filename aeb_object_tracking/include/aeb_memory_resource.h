@@ -0,0 +1,127 @@
+/// @file aeb_memory_resource.h
+/// @brief Memory resources for running the tracker without heap allocation
+/// after initialization.
+/// @details FixedArenaResource is a fixed-capacity bump arena that backs the
+/// tracker storage (sized once by reserveCapacity()) or per-frame query
+/// results. AllocationGuardResource wraps another resource and flags any
+/// allocation made while the steady-state cycle is running.
+
+#ifndef AEB_OBJECT_TRACKING_INCLUDE_AEB_MEMORY_RESOURCE_H
+#define AEB_OBJECT_TRACKING_INCLUDE_AEB_MEMORY_RESOURCE_H
+
+#include <cstddef>          // for size_t, byte, max_align_t
+#include <memory>           // for unique_ptr
+#include <memory_resource>  // for memory_resource, get_default_resource
+
+namespace aeb {
+namespace object_tracking {
+
+/// @brief Monotonic arena over a fixed buffer.
+/// @details Allocation bumps a pointer; deallocation is a no-op and memory is
+/// only reclaimed by release(). There is no upstream: once the buffer is
+/// exhausted allocate() throws std::bad_alloc instead of falling back to the
+/// heap. Containers that only grow through reserve() at init (such as the
+/// tracker storage) therefore never touch the heap afterwards.
+///
+class FixedArenaResource : public std::pmr::memory_resource {
+public:
+  /// @brief Create an arena owning capacity_bytes of heap memory, allocated
+  /// once here.
+  /// @param capacity_bytes Size of the arena in bytes.
+  explicit FixedArenaResource(std::size_t capacity_bytes);
+
+  /// @brief Create an arena over caller-provided memory (e.g. a static
+  /// buffer). The buffer must outlive the arena.
+  /// @param buffer Start of the memory.
+  /// @param capacity_bytes Size of the memory in bytes.
+  FixedArenaResource(void *buffer, std::size_t capacity_bytes) noexcept;
+
+  FixedArenaResource(FixedArenaResource const &) = delete;
+  FixedArenaResource &operator=(FixedArenaResource const &) = delete;
+
+  /// @brief Size of the arena in bytes.
+  std::size_t capacity() const noexcept { return capacity_; }
+
+  /// @brief Bytes handed out so far, including alignment padding. Useful to
+  /// size the arena after a warm-up run.
+  std::size_t used() const noexcept { return used_; }
+
+  /// @brief Make the whole arena available again. Everything allocated
+  /// from it becomes invalid, e.g. per-frame results at the end of a frame.
+  void release() noexcept { used_ = 0U; }
+
+private:
+  std::unique_ptr<std::byte[]> owned_;
+  std::byte *buffer_;
+  std::size_t capacity_;
+  std::size_t used_{0U};
+
+  void *do_allocate(std::size_t bytes, std::size_t alignment) override;
+  void do_deallocate(void *pointer, std::size_t bytes,
+                     std::size_t alignment) override;
+  bool do_is_equal(std::pmr::memory_resource const &other) const
+      noexcept override;
+};
+
+/// @brief Resource that forwards to an upstream resource and reports
+/// allocations made while frozen.
+/// @details Freeze it around the steady-state cycle (ingest, sort, queries)
+/// after initialization. With assert_on_violation, a frozen allocation
+/// fails an assert in debug builds; the count is kept in every build so
+/// that tests and release diagnostics can check it.
+///
+class AllocationGuardResource : public std::pmr::memory_resource {
+public:
+  /// @param upstream Resource that performs the allocations.
+  /// @param assert_on_violation Whether a frozen allocation asserts.
+  explicit AllocationGuardResource(
+      std::pmr::memory_resource *upstream = std::pmr::get_default_resource(),
+      bool assert_on_violation = true) noexcept;
+
+  AllocationGuardResource(AllocationGuardResource const &) = delete;
+  AllocationGuardResource &operator=(AllocationGuardResource const &) = delete;
+
+  /// @brief Start (true) or end (false) the steady-state phase.
+  void setFrozen(bool frozen) noexcept { frozen_ = frozen; }
+  bool isFrozen() const noexcept { return frozen_; }
+
+  /// @brief Allocations made since construction.
+  std::size_t allocationCount() const noexcept { return allocations_; }
+
+  /// @brief Allocations made while frozen.
+  std::size_t violationCount() const noexcept { return violations_; }
+
+private:
+  std::pmr::memory_resource *upstream_;
+  bool assert_on_violation_;
+  bool frozen_{false};
+  std::size_t allocations_{0U};
+  std::size_t violations_{0U};
+
+  void *do_allocate(std::size_t bytes, std::size_t alignment) override;
+  void do_deallocate(void *pointer, std::size_t bytes,
+                     std::size_t alignment) override;
+  bool do_is_equal(std::pmr::memory_resource const &other) const
+      noexcept override;
+};
+
+/// @brief Freezes an AllocationGuardResource for the lifetime of the scope.
+class SteadyStateScope {
+public:
+  explicit SteadyStateScope(AllocationGuardResource &guard) noexcept
+      : guard_{guard} {
+    guard_.setFrozen(true);
+  }
+  ~SteadyStateScope() { guard_.setFrozen(false); }
+
+  SteadyStateScope(SteadyStateScope const &) = delete;
+  SteadyStateScope &operator=(SteadyStateScope const &) = delete;
+
+private:
+  AllocationGuardResource &guard_;
+};
+
+} // namespace object_tracking
+} // namespace aeb
+
+#endif // AEB_OBJECT_TRACKING_INCLUDE_AEB_MEMORY_RESOURCE_H
@@ -0,0 +1,73 @@
+/// @file aeb_object_id_index.h
+/// @brief Open-addressing index from object ID to storage position.
+/// @details Used by AEBObjectTracker to answer findObjectById() in O(1) when
+/// associating the track IDs of the previous frame.
+
+#ifndef AEB_OBJECT_TRACKING_INCLUDE_AEB_OBJECT_ID_INDEX_H
+#define AEB_OBJECT_TRACKING_INCLUDE_AEB_OBJECT_ID_INDEX_H
+
+#include <cstddef>          // for size_t
+#include <limits>           // for numeric_limits
+#include <memory_resource>  // for memory_resource, vector
+
+namespace aeb {
+namespace object_tracking {
+
+/// @brief Hash index mapping object IDs to positions in a tracker's storage.
+/// @details Linear probing over a power-of-two table kept at most half full.
+/// Entries are never erased individually; the owner clears or rebuilds the
+/// index whenever positions change (sorting, clearing).
+///
+class ObjectIdIndex {
+public:
+  /// @brief Returned by find() when the ID is not indexed.
+  static constexpr std::size_t kNotFound =
+      std::numeric_limits<std::size_t>::max();
+
+  /// @brief Create an empty index.
+  /// @param resource Memory resource for the hash table.
+  explicit ObjectIdIndex(
+      std::pmr::memory_resource *resource = std::pmr::get_default_resource());
+
+  /// @brief Make room for capacity IDs without rehashing.
+  /// @param capacity Number of IDs to reserve space for.
+  void reserve(std::size_t capacity);
+
+  /// @brief Remove all entries, keeping the table allocation.
+  void clear() noexcept;
+
+  /// @brief Index an ID unless it is already present (the first position
+  /// of a duplicated ID wins, as with a linear search).
+  /// @param id Object ID.
+  /// @param position Storage position of the object.
+  /// @return true if the ID was inserted.
+  bool insert(int id, std::size_t position);
+
+  /// @brief Look up the position of an ID.
+  /// @param id Object ID.
+  /// @return Storage position or kNotFound.
+  std::size_t find(int id) const noexcept;
+
+  /// @brief Number of indexed IDs.
+  std::size_t size() const noexcept { return size_; }
+
+private:
+  struct Entry {
+    int id;
+    std::size_t position; ///< kNotFound marks an empty bucket
+  };
+
+  std::pmr::vector<Entry> table_;
+  std::size_t size_{0U};
+  std::size_t mask_{0U};
+
+  std::size_t bucketOf(int id) const noexcept;
+  /// @brief Bucket holding id, or the empty bucket where it would go.
+  std::size_t probe(int id) const noexcept;
+  void rehash(std::size_t bucket_count);
+};
+
+} // namespace object_tracking
+} // namespace aeb
+
+#endif // AEB_OBJECT_TRACKING_INCLUDE_AEB_OBJECT_ID_INDEX_H
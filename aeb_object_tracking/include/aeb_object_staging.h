@@ -0,0 +1,85 @@
+/// @file aeb_object_staging.h
+/// @brief Per-producer staging buffers for concurrent multi-sensor ingest.
+/// @details Radar, camera and lidar object lists arrive on separate threads.
+/// Each producer appends to its own staging buffer, without locks or shared
+/// writes, and AEBObjectTracker::commitFrame() merges the buffers into the
+/// tracker once all producers are done with the frame.
+
+#ifndef AEB_OBJECT_TRACKING_INCLUDE_AEB_OBJECT_STAGING_H
+#define AEB_OBJECT_TRACKING_INCLUDE_AEB_OBJECT_STAGING_H
+
+#include <cstddef>               // for size_t
+#include <memory_resource>       // for memory_resource, get_default_resource
+#include <vector>                // for vector
+#include "aeb_detected_object.h" // for DetectedObject, ObjectRange
+
+namespace aeb {
+namespace object_tracking {
+
+/// @brief One staging buffer per producer, each on its own cache lines.
+/// @details Threading contract:
+/// - addObject(p, ...) and sortRun(p) may only be called by producer p; any
+///   number of producers may run at the same time.
+/// - Everything else, including AEBObjectTracker::commitFrame(), requires
+///   that no producer is running (e.g. after a barrier or join).
+/// Buffers keep their capacity across frames, so after reserve() ingest
+/// does not allocate.
+///
+class ObjectStaging {
+public:
+  /// @param producer_count Number of producers (sensors).
+  /// @param resource Memory resource for the buffer contents.
+  explicit ObjectStaging(
+      std::size_t producer_count,
+      std::pmr::memory_resource *resource = std::pmr::get_default_resource());
+
+  /// @brief Number of producers.
+  std::size_t producerCount() const noexcept { return buffers_.size(); }
+
+  /// @brief Reserve capacity in every producer buffer.
+  /// @param objects_per_producer Expected objects per producer and frame.
+  void reserve(std::size_t objects_per_producer);
+
+  /// @brief Stage an object for the current frame.
+  /// @param producer Index of the calling producer.
+  /// @param object DetectedObject to stage.
+  void addObject(std::size_t producer, DetectedObject const &object);
+
+  /// @brief Sort the producer's run by collision time. Producers that call
+  /// this after staging their frame save commitFrame() the work.
+  /// @param producer Index of the calling producer.
+  void sortRun(std::size_t producer);
+
+  /// @brief Objects staged by a producer, in run order.
+  ObjectRange getRun(std::size_t producer) const noexcept;
+
+  /// @brief Whether the producer's run is sorted by collision time.
+  bool isRunSorted(std::size_t producer) const noexcept {
+    return buffers_[producer].sorted;
+  }
+
+  /// @brief Total number of staged objects.
+  std::size_t stagedCount() const noexcept;
+
+  /// @brief Empty all buffers for the next frame (capacity is kept).
+  void clear() noexcept;
+
+private:
+  static constexpr std::size_t kCacheLineSize = 64U;
+
+  /// @brief Aligned and padded so that producers never share a line.
+  struct alignas(kCacheLineSize) ProducerBuffer {
+    explicit ProducerBuffer(std::pmr::memory_resource *resource)
+        : objects{resource} {}
+
+    std::pmr::vector<DetectedObject> objects;
+    bool sorted{true}; ///< An empty run is sorted
+  };
+
+  std::vector<ProducerBuffer> buffers_;
+};
+
+} // namespace object_tracking
+} // namespace aeb
+
+#endif // AEB_OBJECT_TRACKING_INCLUDE_AEB_OBJECT_STAGING_H
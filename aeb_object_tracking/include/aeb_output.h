@@ -20,6 +20,10 @@ class AEBOutput {
 private:
   static constexpr size_t kPerformanceTestSize =
       10000; ///< Number of objects for performance testing
+  static constexpr size_t kLatencyTestFrames =
+      5000; ///< Number of simulated frames for the latency histogram
+  static constexpr size_t kLatencyTestObjects =
+      1000; ///< Number of objects per simulated frame
 
 public:
   /// @brief Run all test suites with detailed output
@@ -44,9 +48,16 @@ private:
 
   /// @brief Performance comparison between full and partial sort with metrics
   /// @details Benchmarks sorting algorithms with large datasets
-  /// Measures execution time and calculates speedup ratios
+  /// Measures execution time and calculates speedup ratios. Single run for
+  /// the demo output; regressions are tracked with the aeb_benchmarks target.
   static void testPerformance();
 
+  /// @brief Tail latency of the full tracker cycle over many frames
+  /// @details Times ingest, partial sort and the critical-object decision of
+  /// every simulated frame into latency histograms and reports
+  /// p50/p90/p99/p99.9/max. Requires AEB_ENABLE_LATENCY_INSTRUMENTATION.
+  static void testFrameLatency();
+
   /// @brief Test edge cases and boundary conditions with validation output
   /// @details Tests empty containers, single objects, and tie-breaking
   /// scenarios Ensures robustness in unusual conditions
@@ -0,0 +1,277 @@
+/// @file aeb_parallel_sort.h
+/// @brief Deterministic multi-threaded sort and partial sort.
+/// @details Used by AEBObjectTracker for fused multi-sensor frames with tens
+/// of thousands of candidates. Given a strict weak ordering, both
+/// algorithms produce the same output for any thread count, including the
+/// single-threaded path taken below the size threshold, so results do not
+/// depend on the machine they run on. Epsilon comparisons are not strict
+/// weak orderings; sort on quantized keys instead.
+
+#ifndef AEB_OBJECT_TRACKING_INCLUDE_AEB_PARALLEL_SORT_H
+#define AEB_OBJECT_TRACKING_INCLUDE_AEB_PARALLEL_SORT_H
+
+#include <algorithm>  // for min, max, stable_sort, inplace_merge, sort...
+#include <array>      // for array
+#include <cstddef>    // for size_t
+#include <cstdint>    // for uint8_t
+#include <iterator>   // for iterator_traits
+#include <numeric>    // for iota
+#include <thread>     // for thread
+#include <type_traits> // for is_default_constructible
+#include <utility>    // for move
+#include <vector>     // for vector
+
+namespace aeb {
+namespace object_tracking {
+
+/// @brief Tuning for the parallel sort overloads.
+struct ParallelSortOptions {
+  /// Frames smaller than this are sorted on the calling thread.
+  std::size_t min_parallel_size{32768U};
+  /// Worker threads including the caller; 0 uses the hardware concurrency.
+  unsigned thread_count{0U};
+};
+
+namespace detail {
+
+/// Smallest chunk handed to a thread; below this the thread start-up cost
+/// dominates the sort itself.
+constexpr std::size_t kMinParallelChunk = 4096U;
+
+/// Largest K selected in place on a single thread, without allocating.
+/// The selection costs O(n) on typical frames but O(n K) on adversarial
+/// (e.g. reverse sorted) ones, so K is kept to the planner's range.
+constexpr std::size_t kMaxInPlaceSelection = 8U;
+
+/// @brief Number of chunks (and threads) to use for count elements.
+inline std::size_t parallelChunkCount(std::size_t count,
+                                      ParallelSortOptions const &options) {
+  if (count < options.min_parallel_size || count < 2U * kMinParallelChunk) {
+    return 1U;
+  }
+  std::size_t threads = options.thread_count;
+  if (threads == 0U) {
+    threads = std::thread::hardware_concurrency();
+  }
+  return std::max<std::size_t>(
+      1U, std::min(threads, count / kMinParallelChunk));
+}
+
+/// @brief Offset of chunk c when count elements are split into chunks parts.
+inline std::size_t chunkBegin(std::size_t c, std::size_t chunks,
+                              std::size_t count) noexcept {
+  return count / chunks * c + std::min(c, count % chunks);
+}
+
+/// @brief Run task(c) for c in [0, chunks); chunk 0 runs on the caller.
+template <typename Task> void runChunks(std::size_t chunks, Task const &task) {
+  std::vector<std::thread> workers;
+  workers.reserve(chunks);
+  for (std::size_t c = 1U; c < chunks; ++c) {
+    workers.emplace_back([&task, c]() { task(c); });
+  }
+  task(0U);
+  for (auto &worker : workers) {
+    worker.join();
+  }
+}
+
+/// @brief Allocation-free single-threaded parallelPartialSort().
+/// @details One pass keeps the positions of the best K elements seen so far
+/// in a small sorted array (ties in scan order); an element that does not
+/// beat the current K-th costs one comparison. The K elements are then
+/// buffered, the rest is shifted back stably, and the buffer is moved to
+/// the front: O(n) moves.
+/// @param first Start of the range.
+/// @param middle End of the sorted prefix; at most kMaxInPlaceSelection
+/// elements after first.
+/// @param last End of the range.
+/// @param comp Strict weak ordering.
+template <typename RandomIt, typename Compare>
+void selectInPlace(RandomIt first, RandomIt middle, RandomIt last,
+                   Compare comp) {
+  using diff_t = typename std::iterator_traits<RandomIt>::difference_type;
+  using value_t = typename std::iterator_traits<RandomIt>::value_type;
+  const auto count = static_cast<std::size_t>(last - first);
+  const auto selected_count = static_cast<std::size_t>(middle - first);
+  auto element = [first](std::size_t position) -> decltype(auto) {
+    return first[static_cast<diff_t>(position)];
+  };
+
+  // Positions of the best elements so far, most critical first.
+  std::array<std::size_t, kMaxInPlaceSelection> best{};
+  std::size_t best_count = 0U;
+  for (std::size_t p = 0U; p < count; ++p) {
+    if (best_count == selected_count &&
+        !comp(element(p), element(best[best_count - 1U]))) {
+      continue;
+    }
+    // A full array drops its last entry.
+    std::size_t slot =
+        (best_count == selected_count) ? best_count - 1U : best_count++;
+    for (; slot > 0U && comp(element(p), element(best[slot - 1U])); --slot) {
+      best[slot] = best[slot - 1U];
+    }
+    best[slot] = p;
+  }
+
+  std::array<value_t, kMaxInPlaceSelection> selected{};
+  for (std::size_t i = 0U; i < selected_count; ++i) {
+    selected[i] = std::move(element(best[i]));
+  }
+  std::sort(best.begin(), best.begin() + static_cast<diff_t>(selected_count));
+  std::size_t write = count;
+  std::size_t skip = selected_count;
+  for (std::size_t p = count; p-- > 0U;) {
+    if (skip > 0U && best[skip - 1U] == p) {
+      --skip;
+    } else {
+      element(--write) = std::move(element(p));
+    }
+  }
+  std::move(selected.begin(),
+            selected.begin() + static_cast<diff_t>(selected_count), first);
+}
+
+} // namespace detail
+
+/// @brief Stable sort of [first, last) using several threads.
+/// @details Chunks are stable-sorted in parallel, then merged pairwise (each
+/// merge level in parallel). Merges keep the left run first on ties, so the
+/// result equals std::stable_sort for any strict weak ordering, whatever the
+/// chunk count. Time complexity: O(n log n / p + n log p).
+/// @param first Start of the range.
+/// @param last End of the range.
+/// @param comp Strict weak ordering.
+/// @param options Size threshold and thread count.
+template <typename RandomIt, typename Compare>
+void parallelStableSort(RandomIt first, RandomIt last, Compare comp,
+                        ParallelSortOptions const &options) {
+  using diff_t = typename std::iterator_traits<RandomIt>::difference_type;
+  const auto count = static_cast<std::size_t>(last - first);
+  const std::size_t chunks = detail::parallelChunkCount(count, options);
+  if (chunks == 1U) {
+    std::stable_sort(first, last, comp);
+    return;
+  }
+
+  std::vector<std::size_t> bounds(chunks + 1U);
+  for (std::size_t c = 0; c <= chunks; ++c) {
+    bounds[c] = detail::chunkBegin(c, chunks, count);
+  }
+  auto at = [first](std::size_t offset) {
+    return first + static_cast<diff_t>(offset);
+  };
+
+  detail::runChunks(chunks, [&](std::size_t c) {
+    std::stable_sort(at(bounds[c]), at(bounds[c + 1U]), comp);
+  });
+
+  // Merge adjacent runs until one is left; bounds keeps the run edges.
+  while (bounds.size() > 2U) {
+    const std::size_t runs = bounds.size() - 1U;
+    detail::runChunks(runs / 2U, [&](std::size_t pair) {
+      const std::size_t left = 2U * pair;
+      std::inplace_merge(at(bounds[left]), at(bounds[left + 1U]),
+                         at(bounds[left + 2U]), comp);
+    });
+    std::vector<std::size_t> merged;
+    merged.reserve(runs / 2U + 2U);
+    for (std::size_t i = 0; i < bounds.size(); i += 2U) {
+      merged.push_back(bounds[i]);
+    }
+    if (merged.back() != count) {
+      merged.push_back(count);
+    }
+    bounds = std::move(merged);
+  }
+}
+
+/// @brief Partial sort of [first, last) using several threads.
+/// @details Afterwards [first, middle) holds the middle - first smallest
+/// elements in the order std::stable_sort would give them, and
+/// [middle, last) holds the remaining elements in their original relative
+/// order. Each chunk selects its own candidates in parallel with ties broken
+/// by position, so the selection is unique and independent of the chunk
+/// count. Time complexity: O(n log k / p + p k log(p k)), Space: O(n).
+/// Single-threaded (below options.min_parallel_size) with k up to
+/// detail::kMaxInPlaceSelection and default-constructible elements, the
+/// selection is done by detail::selectInPlace() without allocating.
+/// @param first Start of the range.
+/// @param middle End of the sorted prefix.
+/// @param last End of the range.
+/// @param comp Strict weak ordering.
+/// @param options Size threshold and thread count.
+template <typename RandomIt, typename Compare>
+void parallelPartialSort(RandomIt first, RandomIt middle, RandomIt last,
+                         Compare comp, ParallelSortOptions const &options) {
+  using diff_t = typename std::iterator_traits<RandomIt>::difference_type;
+  using value_t = typename std::iterator_traits<RandomIt>::value_type;
+  const auto count = static_cast<std::size_t>(last - first);
+  const auto selected_count = static_cast<std::size_t>(middle - first);
+  if (selected_count == 0U) {
+    return;
+  }
+
+  // Total order over positions: comp first, then original position.
+  auto position_less = [first, &comp](std::size_t a, std::size_t b) {
+    if (comp(first[static_cast<diff_t>(a)], first[static_cast<diff_t>(b)])) {
+      return true;
+    }
+    if (comp(first[static_cast<diff_t>(b)], first[static_cast<diff_t>(a)])) {
+      return false;
+    }
+    return a < b;
+  };
+
+  const std::size_t chunks = detail::parallelChunkCount(count, options);
+  if constexpr (std::is_default_constructible<value_t>::value) {
+    if (chunks == 1U && selected_count <= detail::kMaxInPlaceSelection) {
+      detail::selectInPlace(first, middle, last, comp);
+      return;
+    }
+  }
+
+  std::vector<std::vector<std::size_t>> candidates(chunks);
+  detail::runChunks(chunks, [&](std::size_t c) {
+    const std::size_t begin = detail::chunkBegin(c, chunks, count);
+    const std::size_t end = detail::chunkBegin(c + 1U, chunks, count);
+    auto &positions = candidates[c];
+    positions.resize(end - begin);
+    std::iota(positions.begin(), positions.end(), begin);
+    const std::size_t keep = std::min(selected_count, positions.size());
+    std::partial_sort(positions.begin(),
+                      positions.begin() + static_cast<diff_t>(keep),
+                      positions.end(), position_less);
+    positions.resize(keep);
+  });
+
+  std::vector<std::size_t> selected = std::move(candidates[0]);
+  for (std::size_t c = 1U; c < chunks; ++c) {
+    selected.insert(selected.end(), candidates[c].begin(),
+                    candidates[c].end());
+  }
+  std::partial_sort(selected.begin(),
+                    selected.begin() + static_cast<diff_t>(selected_count),
+                    selected.end(), position_less);
+  selected.resize(selected_count);
+
+  std::vector<std::uint8_t> is_selected(count, 0U);
+  std::vector<value_t> result;
+  result.reserve(count);
+  for (const std::size_t position : selected) {
+    is_selected[position] = 1U;
+    result.push_back(std::move(first[static_cast<diff_t>(position)]));
+  }
+  for (std::size_t i = 0; i < count; ++i) {
+    if (is_selected[i] == 0U) {
+      result.push_back(std::move(first[static_cast<diff_t>(i)]));
+    }
+  }
+  std::move(result.begin(), result.end(), first);
+}
+
+} // namespace object_tracking
+} // namespace aeb
+
+#endif // AEB_OBJECT_TRACKING_INCLUDE_AEB_PARALLEL_SORT_H
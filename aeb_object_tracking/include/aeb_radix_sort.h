@@ -0,0 +1,143 @@
+/// @file aeb_radix_sort.h
+/// @brief LSD radix sort on 64-bit integer sort keys.
+/// @details Lets AEBObjectTracker order a frame without the branchy
+/// comparator: each object is mapped once to a monotone integer key, then
+/// the keys are sorted with a fixed number of linear passes.
+
+#ifndef AEB_OBJECT_TRACKING_INCLUDE_AEB_RADIX_SORT_H
+#define AEB_OBJECT_TRACKING_INCLUDE_AEB_RADIX_SORT_H
+
+#include <algorithm>        // for min, max
+#include <cmath>            // for isinf, isnan
+#include <cstddef>          // for size_t
+#include <cstdint>          // for uint32_t, uint64_t
+#include <cstring>          // for memcpy
+#include <memory_resource>  // for memory_resource, vector
+
+namespace aeb {
+namespace object_tracking {
+
+/// @brief Map a float to an unsigned integer with the same ordering.
+/// @details Negative values have all bits flipped, positive values the sign
+/// bit set. -0.0f and +0.0f map to the same key.
+/// @param value Float to map (not NaN).
+/// @return Key that compares like value.
+inline std::uint32_t orderedFloatBits(float value) noexcept {
+  value += 0.0f; // -0.0f -> +0.0f
+  std::uint32_t bits;
+  std::memcpy(&bits, &value, sizeof(bits));
+  return ((bits & 0x80000000U) != 0U) ? ~bits : (bits | 0x80000000U);
+}
+
+/// @brief Sort key consistent with AEBObjectTracker::Comparators::
+/// byCollisionTime.
+/// @details The upper half holds the TTC; every infinite TTC maps to the
+/// top of the range, above any finite TTC. The lower half holds the
+/// distance, which breaks ties between infinite TTCs exactly like the
+/// comparator (and between equal finite TTCs, where the comparator leaves
+/// the order open).
+/// @param collision_time Time to collision in seconds.
+/// @param distance Distance in meters.
+/// @return Key whose ascending order is most to least critical.
+inline std::uint64_t collisionTimeSortKey(float collision_time,
+                                          float distance) noexcept {
+  const std::uint32_t time_bits = std::isinf(collision_time)
+                                      ? 0xFFFFFFFFU
+                                      : orderedFloatBits(collision_time);
+  return (std::uint64_t{time_bits} << 32U) | orderedFloatBits(distance);
+}
+
+/// @brief Sort key for the threat level order.
+/// @details The upper half holds the threat level in 0.001 buckets (the
+/// epsilon of Comparators::byThreatLevel), inverted so that higher threat
+/// sorts first; the lower half holds the distance, which orders objects
+/// within a bucket. Unlike the epsilon comparison this is a strict weak
+/// order.
+/// @param threat_level Threat level from 0.0 to 1.0.
+/// @param distance Distance in meters.
+/// @return Key whose ascending order is most to least threatening.
+inline std::uint64_t threatLevelSortKey(float threat_level,
+                                        float distance) noexcept {
+  constexpr std::uint32_t kThreatBuckets = 1000U; // 0.001 per bucket
+  const float threat = std::min(std::max(threat_level, 0.0f), 1.0f);
+  const std::uint32_t threat_bits =
+      kThreatBuckets - static_cast<std::uint32_t>(
+                           threat * static_cast<float>(kThreatBuckets) + 0.5f);
+  return (std::uint64_t{threat_bits} << 32U) | orderedFloatBits(distance);
+}
+
+/// @brief Packed sort key for the multi-criteria order.
+/// @details Quantizes the three criteria of the multi-criteria comparison
+/// into one integer, most significant first:
+/// - bits 56-63: threat level in 0.01 buckets, inverted (higher first);
+/// - bits 32-55: TTC in 0.1 s buckets, infinite TTC last (negative TTCs
+///   share bucket 0);
+/// - bits 0-31: distance (closer first).
+/// Unlike the epsilon comparison, the bucketed order is a strict weak order,
+/// so the result no longer depends on the sort algorithm or the input order.
+/// Objects whose criteria differ by more than the epsilons are ordered as
+/// before; near-equal ones may now land in neighbouring buckets.
+/// @param threat_level Threat level from 0.0 to 1.0.
+/// @param collision_time Time to collision in seconds.
+/// @param distance Distance in meters.
+/// @return Key whose ascending order is most to least critical.
+inline std::uint64_t multiCriteriaSortKey(float threat_level,
+                                          float collision_time,
+                                          float distance) noexcept {
+  constexpr std::uint32_t kThreatBuckets = 100U;  // 0.01 per bucket
+  constexpr float kTimeBucketsPerSecond = 10.0f;  // 0.1 s per bucket
+  constexpr std::uint32_t kMaxTimeBucket = 0xFFFFFEU;
+
+  const float threat = std::min(std::max(threat_level, 0.0f), 1.0f);
+  const std::uint32_t threat_bits =
+      kThreatBuckets - static_cast<std::uint32_t>(
+                           threat * static_cast<float>(kThreatBuckets) + 0.5f);
+
+  std::uint32_t time_bits = kMaxTimeBucket + 1U;
+  if (!std::isinf(collision_time) && !std::isnan(collision_time)) {
+    const float bucket =
+        std::max(collision_time, 0.0f) * kTimeBucketsPerSecond;
+    time_bits = (bucket >= static_cast<float>(kMaxTimeBucket))
+                    ? kMaxTimeBucket
+                    : static_cast<std::uint32_t>(bucket);
+  }
+
+  return (std::uint64_t{threat_bits} << 56U) |
+         (std::uint64_t{time_bits} << 32U) | orderedFloatBits(distance);
+}
+
+/// @brief Stable LSD radix sort over 64-bit keys, 8 bits per pass.
+/// @details A single counting pass builds the histograms of all eight
+/// bytes; bytes that are equal across the frame (e.g. the exponent bytes of
+/// similar TTCs) are skipped. The cost is therefore at most eight linear
+/// passes regardless of the input order. Scratch buffers are kept between
+/// calls, so steady-state sorts do not allocate.
+///
+class RadixKeySorter {
+public:
+  /// @param resource Memory resource for the scratch buffers.
+  explicit RadixKeySorter(
+      std::pmr::memory_resource *resource = std::pmr::get_default_resource());
+
+  /// @brief Size the scratch buffers for count keys up front.
+  void reserve(std::size_t count);
+
+  /// @brief Compute the stable ascending order of keys.
+  /// @param keys Sort keys, one per element.
+  /// @param count Number of keys (less than 2^32).
+  /// @return order[i] is the position of the i-th smallest key. Valid until
+  /// the next call.
+  std::pmr::vector<std::uint32_t> const &sort(std::uint64_t const *keys,
+                                              std::size_t count);
+
+private:
+  std::pmr::vector<std::uint64_t> keys_;
+  std::pmr::vector<std::uint64_t> key_scratch_;
+  std::pmr::vector<std::uint32_t> order_;
+  std::pmr::vector<std::uint32_t> order_scratch_;
+};
+
+} // namespace object_tracking
+} // namespace aeb
+
+#endif // AEB_OBJECT_TRACKING_INCLUDE_AEB_RADIX_SORT_H
@@ -0,0 +1,138 @@
+/// @file aeb_simd.h
+/// @brief Batch (SIMD) kernels for AEB object tracking.
+/// @details Kernels operate on contiguous columns of object attributes, as
+/// stored by ColumnarObjectTracker. The instruction set is selected at compile
+/// time: AVX2 when the library is built with AEB_ENABLE_AVX2, SSE2 on any
+/// other x86-64 build, and a portable scalar loop elsewhere. All paths produce
+/// results bit-identical to DetectedObject.
+
+#ifndef AEB_OBJECT_TRACKING_INCLUDE_AEB_SIMD_H
+#define AEB_OBJECT_TRACKING_INCLUDE_AEB_SIMD_H
+
+#include <cstddef>  // for size_t
+#include "aeb_collision_model.h"  // for EgoMotion
+
+namespace aeb {
+namespace object_tracking {
+namespace simd {
+
+/// @brief Name of the instruction set the kernels were compiled for.
+/// @return "AVX2", "SSE2" or "scalar".
+char const *activeInstructionSet() noexcept;
+
+/// @brief Compute TTC and threat level for a whole frame.
+/// @details Vectorized equivalent of constructing a DetectedObject for every
+/// (distance, relative velocity) pair. Infinity and threat level bands are
+/// handled with branchless selects.
+/// @param distances Distances in meters.
+/// @param relative_velocities Relative velocities in m/s.
+/// @param collision_times Output TTC in seconds.
+/// @param threat_levels Output threat levels (0.0 to 1.0).
+/// @param count Number of objects in every array.
+void computeCollisionTimes(float const *distances,
+                           float const *relative_velocities,
+                           float *collision_times, float *threat_levels,
+                           std::size_t count) noexcept;
+
+/// @brief Scalar fallback of computeCollisionTimes().
+/// @details Always available; used for the tail of a vectorized batch and as
+/// reference implementation.
+void computeCollisionTimesScalar(float const *distances,
+                                 float const *relative_velocities,
+                                 float *collision_times, float *threat_levels,
+                                 std::size_t count) noexcept;
+
+/// @brief Compute constant-acceleration TTC and threat level for a whole
+/// frame, compensating ego motion.
+/// @details Vectorized equivalent of constructing a DetectedObject with
+/// (distance, velocity - ego.speed, acceleration - ego.acceleration) for
+/// every object, in one pass: the relative velocities are written out with
+/// the TTC, so the caller does not derive them again. The quadratic is
+/// solved with a square root and branchless selects.
+/// @param distances Distances in meters.
+/// @param velocities Object velocities in m/s: over ground, or relative
+/// with a default EgoMotion.
+/// @param accelerations Object accelerations in m/s^2, same frame as
+/// velocities.
+/// @param ego Ego vehicle motion.
+/// @param relative_velocities Output relative velocities in m/s; may be the
+/// velocities array itself.
+/// @param collision_times Output TTC in seconds.
+/// @param threat_levels Output threat levels (0.0 to 1.0).
+/// @param count Number of objects in every array.
+void computeCollisionTimes(float const *distances, float const *velocities,
+                           float const *accelerations, EgoMotion const &ego,
+                           float *relative_velocities, float *collision_times,
+                           float *threat_levels, std::size_t count) noexcept;
+
+/// @brief Scalar fallback of the constant-acceleration
+/// computeCollisionTimes().
+void computeCollisionTimesScalar(float const *distances,
+                                 float const *velocities,
+                                 float const *accelerations,
+                                 EgoMotion const &ego,
+                                 float *relative_velocities,
+                                 float *collision_times, float *threat_levels,
+                                 std::size_t count) noexcept;
+
+/// @brief Extrapolate a frame by step_time and compute the predicted TTC and
+/// threat level.
+/// @details Distance d + v t + a t^2 / 2 and velocity v + a t under each
+/// object's constant relative acceleration a; TTC and threat level as for a
+/// DetectedObject built from them with that acceleration. Objects whose
+/// current TTC is within step_time have reached the ego vehicle: their
+/// projected distance and TTC are 0.
+/// @param distances Distances in meters.
+/// @param relative_velocities Relative velocities in m/s.
+/// @param relative_accelerations Relative accelerations in m/s^2.
+/// @param collision_times Current TTC in seconds under the same
+/// accelerations.
+/// @param count Number of objects in every array.
+/// @param step_time Time to extrapolate by, in seconds.
+/// @param projected_distances Output distances in meters.
+/// @param projected_velocities Output relative velocities in m/s.
+/// @param projected_collision_times Output TTC in seconds.
+/// @param projected_threat_levels Output threat levels (0.0 to 1.0).
+void projectCollisionTimes(float const *distances,
+                           float const *relative_velocities,
+                           float const *relative_accelerations,
+                           float const *collision_times, std::size_t count,
+                           float step_time, float *projected_distances,
+                           float *projected_velocities,
+                           float *projected_collision_times,
+                           float *projected_threat_levels) noexcept;
+
+/// @brief Scalar fallback of projectCollisionTimes().
+void projectCollisionTimesScalar(
+    float const *distances, float const *relative_velocities,
+    float const *relative_accelerations, float const *collision_times,
+    std::size_t count, float step_time, float *projected_distances,
+    float *projected_velocities, float *projected_collision_times,
+    float *projected_threat_levels) noexcept;
+
+/// @brief Check if any finite collision time is within the threshold.
+/// @details Block-wise scan: masks of several vectors are combined and tested
+/// once per block, returning as soon as a block contains a match.
+/// @param collision_times TTC column in seconds.
+/// @param count Number of entries.
+/// @param threshold_seconds Time threshold in seconds.
+/// @return true if any entry is finite and <= threshold_seconds.
+bool anyWithinThreshold(float const *collision_times, std::size_t count,
+                        float threshold_seconds) noexcept;
+
+/// @brief Write the indices of all finite collision times within the
+/// threshold, in ascending order (compress-store).
+/// @param collision_times TTC column in seconds.
+/// @param count Number of entries.
+/// @param threshold_seconds Time threshold in seconds.
+/// @param indices Output buffer; must have room for count entries.
+/// @return Number of indices written.
+std::size_t filterWithinThreshold(float const *collision_times,
+                                  std::size_t count, float threshold_seconds,
+                                  std::size_t *indices) noexcept;
+
+} // namespace simd
+} // namespace object_tracking
+} // namespace aeb
+
+#endif // AEB_OBJECT_TRACKING_INCLUDE_AEB_SIMD_H
@@ -0,0 +1,167 @@
+/// @file aeb_static_object_tracker.h
+/// @brief Fixed-capacity object tracker backed by an inline array.
+/// @details StaticObjectTracker<N> mirrors the AEBObjectTracker API for
+/// hard real-time use: the capacity is a compile-time constant, the storage
+/// lives inside the object (static_vector semantics), and no operation ever
+/// calls an allocator. What happens to the N+1-th object is defined by an
+/// OverflowPolicy.
+
+#ifndef AEB_OBJECT_TRACKING_INCLUDE_AEB_STATIC_OBJECT_TRACKER_H
+#define AEB_OBJECT_TRACKING_INCLUDE_AEB_STATIC_OBJECT_TRACKER_H
+
+#include <algorithm>             // for sort, partial_sort, find_if, min, ...
+#include <array>                 // for array
+#include <cstddef>               // for size_t, ptrdiff_t
+#include <type_traits>           // for is_trivially_copyable
+#include "aeb_detected_object.h" // for DetectedObject, ObjectRange, ...
+#include "aeb_tracker.h"         // for AEBObjectTracker::Comparators
+
+namespace aeb {
+namespace object_tracking {
+
+/// @brief What addObject() does when the tracker is full.
+enum class OverflowPolicy {
+  kReject,            ///< Keep the stored objects, drop the new one
+  kDropLeastCritical, ///< Replace the object with the latest collision time
+  kEvictFarthest,     ///< Replace the object with the largest distance
+};
+
+/// @brief Allocation-free tracker holding at most N objects.
+/// @details Same query and sort semantics as AEBObjectTracker; containers
+/// in the results are replaced by ObjectRange views into the inline array.
+/// Replacing an object under an overflow policy is an O(N) scan, paid only
+/// once the tracker is full.
+/// @tparam N Maximum number of objects.
+/// @tparam Policy Overflow behavior of addObject().
+///
+template <std::size_t N,
+          OverflowPolicy Policy = OverflowPolicy::kDropLeastCritical>
+class StaticObjectTracker {
+  static_assert(N > 0U, "StaticObjectTracker needs a capacity of at least 1");
+  static_assert(std::is_trivially_copyable<DetectedObject>::value,
+                "Inline storage relies on trivially copyable objects");
+
+public:
+  using const_iterator = ObjectRange::const_iterator;
+
+  /// @brief Add an object, applying Policy when the tracker is full.
+  /// @param object DetectedObject to add.
+  /// @return true if the object is stored; false if it was dropped.
+  bool addObject(DetectedObject const &object) noexcept {
+    if (size_ < N) {
+      objects_[size_++] = object;
+      return true;
+    }
+    ++overflow_count_;
+    if constexpr (Policy == OverflowPolicy::kReject) {
+      return false;
+    } else if constexpr (Policy == OverflowPolicy::kDropLeastCritical) {
+      auto *const least = std::max_element(
+          begin(), end(), AEBObjectTracker::Comparators::byCollisionTime);
+      if (!AEBObjectTracker::Comparators::byCollisionTime(object, *least)) {
+        return false;
+      }
+      *least = object;
+      return true;
+    } else {
+      auto *const farthest = std::max_element(
+          begin(), end(),
+          [](DetectedObject const &a, DetectedObject const &b) noexcept {
+            return a.getDistance() < b.getDistance();
+          });
+      if (!(object.getDistance() < farthest->getDistance())) {
+        return false;
+      }
+      *farthest = object;
+      return true;
+    }
+  }
+
+  /// @brief Remove all objects. The overflow count is kept.
+  constexpr void clear() noexcept { size_ = 0U; }
+
+  /// @brief View over all tracked objects.
+  constexpr ObjectRange getObjects() const noexcept {
+    return ObjectRange(objects_.data(), size_);
+  }
+
+  constexpr std::size_t size() const noexcept { return size_; }
+  constexpr bool empty() const noexcept { return size_ == 0U; }
+  constexpr bool full() const noexcept { return size_ == N; }
+  static constexpr std::size_t capacity() noexcept { return N; }
+  static constexpr OverflowPolicy overflowPolicy() noexcept { return Policy; }
+
+  /// @brief Number of addObject() calls made while the tracker was full.
+  constexpr std::size_t overflowCount() const noexcept {
+    return overflow_count_;
+  }
+
+  /// @brief Sort all objects by collision time (introsort).
+  void sortByCollisionTime() noexcept {
+    std::sort(begin(), end(), AEBObjectTracker::Comparators::byCollisionTime);
+  }
+
+  /// @brief Sort all objects by threat level (introsort).
+  void sortByThreatLevel() noexcept {
+    std::sort(begin(), end(), AEBObjectTracker::Comparators::byThreatLevel);
+  }
+
+  /// @brief Multi-criteria sort, as AEBObjectTracker::sortMultiCriteria().
+  void sortMultiCriteria() noexcept {
+    std::sort(begin(), end(), AEBObjectTracker::Comparators::byMultiCriteria);
+  }
+
+  /// @brief Sort only the max_objects most critical objects to the front.
+  /// @param max_objects Number of objects to sort.
+  void partialSortCriticalObjects(std::size_t max_objects) noexcept {
+    auto *const middle =
+        begin() + static_cast<std::ptrdiff_t>(std::min(max_objects, size_));
+    std::partial_sort(begin(), middle, end(),
+                      AEBObjectTracker::Comparators::byCollisionTime);
+  }
+
+  /// @brief View over the sorted prefix (assumes partialSortCriticalObjects
+  /// was called).
+  /// @param max_objects Maximum number of objects in the view.
+  constexpr ObjectRange
+  getCriticalObjectsView(std::size_t max_objects) const noexcept {
+    return ObjectRange(objects_.data(), std::min(max_objects, size_));
+  }
+
+  /// @brief Lazy view over the objects within a collision time threshold.
+  /// @param threshold_seconds Time threshold in seconds.
+  ThresholdObjectRange
+  getObjectsWithinTimeThresholdView(float threshold_seconds) const noexcept {
+    return ThresholdObjectRange(getObjects(), threshold_seconds);
+  }
+
+  /// @brief Check if any object is within the collision time threshold.
+  /// @param threshold_seconds Critical time threshold in seconds.
+  bool hasCriticalObjects(float threshold_seconds) const noexcept {
+    return !getObjectsWithinTimeThresholdView(threshold_seconds).empty();
+  }
+
+  /// @brief Find object by ID.
+  /// @param id Object ID to search for.
+  /// @return Pointer to the object or getObjects().end() if not found.
+  const_iterator findObjectById(int id) const noexcept {
+    const ObjectRange objects = getObjects();
+    return std::find_if(objects.begin(), objects.end(),
+                        [id](DetectedObject const &obj) noexcept {
+                          return obj.getId() == id;
+                        });
+  }
+
+private:
+  std::array<DetectedObject, N> objects_{};
+  std::size_t size_{0U};
+  std::size_t overflow_count_{0U};
+
+  DetectedObject *begin() noexcept { return objects_.data(); }
+  DetectedObject *end() noexcept { return objects_.data() + size_; }
+};
+
+} // namespace object_tracking
+} // namespace aeb
+
+#endif // AEB_OBJECT_TRACKING_INCLUDE_AEB_STATIC_OBJECT_TRACKER_H
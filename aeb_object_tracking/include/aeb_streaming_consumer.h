@@ -0,0 +1,92 @@
+/// @file aeb_streaming_consumer.h
+/// @brief Streaming ingest of raw detections into a bounded top-K and TTC
+/// band counters.
+/// @details A long-range radar scan can hold tens of thousands of raw
+/// detections of which the planner needs only the K most critical and how
+/// many fall into each TTC band. StreamingObjectConsumer keeps exactly that,
+/// so memory stays O(K + bands) however large the scan is, and no frame is
+/// ever materialized.
+
+#ifndef AEB_OBJECT_TRACKING_INCLUDE_AEB_STREAMING_CONSUMER_H
+#define AEB_OBJECT_TRACKING_INCLUDE_AEB_STREAMING_CONSUMER_H
+
+#include <array>                          // for array
+#include <cstddef>                        // for size_t
+#include <memory_resource>                // for memory_resource
+#include <vector>                         // for vector
+#include "aeb_critical_object_set.h"      // for CriticalObjectSet
+#include "aeb_detected_object.h"          // for DetectedObject, ObjectRange
+#include "aeb_threshold_classification.h" // for ThresholdClassification
+
+namespace aeb {
+namespace object_tracking {
+
+/// @brief Bounded consumer of a detection stream.
+/// @details Detections are accepted one at a time, as object ranges or as
+/// columns of raw measurements; all of them give the same result. Columns
+/// are processed in fixed-size chunks: TTCs of a chunk are computed with the
+/// SIMD kernel, every detection is counted into its band, and a
+/// DetectedObject is only built for detections that can still enter the
+/// top-K. Band positions (ThresholdClassification::firstIndex()) count
+/// detections in arrival order since beginScan().
+///
+class StreamingObjectConsumer {
+public:
+  /// @param max_objects Number of critical objects to keep (K).
+  /// @param band_thresholds TTC band upper bounds in seconds, ascending.
+  /// @param resource Memory resource for the top-K storage.
+  StreamingObjectConsumer(
+      std::size_t max_objects, std::vector<float> const &band_thresholds,
+      std::pmr::memory_resource *resource = std::pmr::get_default_resource());
+
+  /// @brief Start a new scan: forget the top-K and zero the counters.
+  void beginScan();
+
+  /// @brief Consume a single detection.
+  void consume(DetectedObject const &object);
+
+  /// @brief Consume a chunk of detections.
+  void consume(ObjectRange objects);
+
+  /// @brief Consume raw measurements column by column.
+  /// @param ids Object IDs.
+  /// @param distances Distances in meters.
+  /// @param relative_velocities Relative velocities in m/s.
+  /// @param count Number of detections in every array.
+  void consume(int const *ids, float const *distances,
+               float const *relative_velocities, std::size_t count);
+
+  /// @brief The K most critical detections so far, most critical first.
+  ObjectRange criticalObjects() const noexcept {
+    return critical_set_.objects();
+  }
+
+  /// @brief Per-band detection counts of the scan.
+  ThresholdClassification const &bands() const noexcept { return bands_; }
+
+  /// @brief Detections consumed since beginScan().
+  std::size_t consumedCount() const noexcept { return consumed_; }
+
+  /// @brief Detections in no band: not approaching, or a TTC beyond the
+  /// last threshold.
+  std::size_t beyondBandsCount() const;
+
+private:
+  /// Detections per chunk of the columnar path (two stack-sized buffers).
+  static constexpr std::size_t kChunkSize = 256U;
+
+  std::vector<float> band_thresholds_;
+  ThresholdClassification bands_;
+  CriticalObjectSet critical_set_;
+  std::size_t consumed_{0U};
+  std::array<float, kChunkSize> chunk_collision_times_{};
+  std::array<float, kChunkSize> chunk_threat_levels_{};
+
+  /// @brief Whether a detection with this TTC can enter a full top-K.
+  bool mayBeCritical(float collision_time) const noexcept;
+};
+
+} // namespace object_tracking
+} // namespace aeb
+
+#endif // AEB_OBJECT_TRACKING_INCLUDE_AEB_STREAMING_CONSUMER_H
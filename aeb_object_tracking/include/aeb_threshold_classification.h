@@ -0,0 +1,79 @@
+/// @file aeb_threshold_classification.h
+/// @brief Single-pass classification of objects into TTC threshold bands.
+/// @details Replaces repeated hasCriticalObjects() /
+/// getObjectsWithinTimeThreshold() scans with one pass that answers every
+/// threshold of a control cycle at once.
+
+#ifndef AEB_OBJECT_TRACKING_INCLUDE_AEB_THRESHOLD_CLASSIFICATION_H
+#define AEB_OBJECT_TRACKING_INCLUDE_AEB_THRESHOLD_CLASSIFICATION_H
+
+#include <cstddef>  // for size_t
+#include <limits>   // for numeric_limits
+#include <vector>   // for vector
+
+namespace aeb {
+namespace object_tracking {
+
+/// @brief Per-band result of a fused multi-threshold pass.
+/// @details For ascending thresholds t0 < t1 < ... band 0 holds objects with
+/// a finite TTC <= t0 and band i holds objects with t(i-1) < TTC <= t(i).
+/// Objects with infinite TTC or TTC above the last threshold belong to no
+/// band. Indices are positions in the tracker's storage order.
+///
+class ThresholdClassification {
+public:
+  /// @brief Returned by firstIndex() / firstWithin() for empty bands.
+  static constexpr std::size_t kNoMatch =
+      std::numeric_limits<std::size_t>::max();
+
+  /// @brief Prepare for a new pass, keeping allocated capacity.
+  /// @param thresholds TTC band upper bounds in seconds, sorted ascending.
+  /// @param collect_indices Whether to record per-band index lists.
+  void reset(std::vector<float> const &thresholds, bool collect_indices);
+
+  /// @brief Classify one object.
+  /// @param index Position of the object in storage order.
+  /// @param collision_time TTC of the object in seconds.
+  void record(std::size_t index, float collision_time);
+
+  /// @brief Number of bands (equals the number of thresholds).
+  std::size_t bandCount() const { return thresholds_.size(); }
+
+  /// @brief Upper bound of a band in seconds.
+  float threshold(std::size_t band) const { return thresholds_[band]; }
+
+  /// @brief Number of objects in a single band.
+  std::size_t count(std::size_t band) const { return band_counts_[band]; }
+
+  /// @brief First position that fell into a single band, or kNoMatch.
+  std::size_t firstIndex(std::size_t band) const {
+    return first_indices_[band];
+  }
+
+  /// @brief Positions in a single band, in storage order.
+  /// Empty unless the pass was run with collect_indices.
+  std::vector<std::size_t> const &indices(std::size_t band) const {
+    return band_indices_[band];
+  }
+
+  /// @brief Number of objects with TTC <= threshold(band) (bands 0..band).
+  std::size_t countWithin(std::size_t band) const;
+
+  /// @brief Equivalent of hasCriticalObjects(threshold(band)).
+  bool anyWithin(std::size_t band) const { return countWithin(band) != 0U; }
+
+  /// @brief First position with TTC <= threshold(band), or kNoMatch.
+  std::size_t firstWithin(std::size_t band) const;
+
+private:
+  std::vector<float> thresholds_;
+  std::vector<std::size_t> band_counts_;
+  std::vector<std::size_t> first_indices_;
+  std::vector<std::vector<std::size_t>> band_indices_;
+  bool collect_indices_{false};
+};
+
+} // namespace object_tracking
+} // namespace aeb
+
+#endif // AEB_OBJECT_TRACKING_INCLUDE_AEB_THRESHOLD_CLASSIFICATION_H
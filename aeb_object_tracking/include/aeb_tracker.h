@@ -1,7 +1,8 @@
 /// \file aeb_tracker.h
 /// @brief AEB object tracking system header.
-/// @details Defines DetectedObject and AEBObjectTracker classes for
-/// collision risk analysis in autonomous emergency braking systems.
+/// @details Defines the AEBObjectTracker class for collision risk analysis in
+/// autonomous emergency braking systems. DetectedObject lives in
+/// aeb_detected_object.h.
 
 #ifndef AEB_OBJECT_TRACKING_INCLUDE_AEB_TRACKER_H
 #define AEB_OBJECT_TRACKING_INCLUDE_AEB_TRACKER_H
@@ -9,47 +10,24 @@
 #include <bits/std_abs.h>  // for abs
 #include <cmath>           // for isinf
 #include <cstddef>         // for size_t
+#include <cstdint>         // for uint64_t
+#include <memory_resource> // for memory_resource, polymorphic_allocator
 #include <string>          // for allocator, string
 #include <vector>          // for vector
+#include "aeb_collision_forecast.h"        // for CollisionForecast
+#include "aeb_critical_object_set.h"       // for CriticalObjectSet
+#include "aeb_detected_object.h"           // for DetectedObject, ObjectRange
+#include "aeb_kway_merge.h"                // for KWayMerger
+#include "aeb_object_staging.h"            // for ObjectStaging
+#include "aeb_object_id_index.h"           // for ObjectIdIndex
+#include "aeb_parallel_sort.h"             // for ParallelSortOptions
+#include "aeb_radix_sort.h"                // for RadixKeySorter
+#include "aeb_threshold_classification.h"  // for ThresholdClassification
 
 namespace aeb {
 namespace object_tracking {
 
-/// @brief Detected objects for Autonomous Emergency Braking and Collision
-/// Warning Systems (AEB/CW).
-/// @details This class represents an object detected by AEB tracking system,
-/// encapsulating its unique identifier, distance, relative velocity, estimated
-/// collision time, and calculated threat level.
-///
-/// The threat level is computed based on object dynamics and is used to assess
-/// collision risk.
-///
-class DetectedObject {
-public:
-  // Constructors
-  DetectedObject(int obj_id, float dist, float rel_vel) noexcept;
-  DetectedObject() noexcept;
-
-  // Getters
-  constexpr int getId() const { return id_; }
-  constexpr float getDistance() const { return distance_; }
-  constexpr float getRelativeVelocity() const { return relative_velocity_; }
-  constexpr float getCollisionTime() const { return collision_time_; }
-  constexpr float getThreatLevel() const { return threat_level_; }
-
-  // Comparison operators for sorting
-  bool operator<(const DetectedObject &other) const noexcept;
-  bool operator==(const DetectedObject &other) const noexcept;
-
-private:
-  int id_;
-  float distance_;          // meters
-  float relative_velocity_; // m/s (negative = approaching)
-  float collision_time_;    // seconds (calculated TTC)
-  float threat_level_;      // 0.0 to 1.0
-
-  constexpr float calculateThreatLevel() const noexcept;
-};
+class FrameRecorder;
 
 /// @brief AEB Object Tracking System.
 /// @details Main class for managing detected objects and performing collision
@@ -57,8 +35,21 @@ private:
 /// It uses introsort (std::sort) for full sorting and partial sort
 /// for optimization.
 ///
+/// All storage comes from the memory resource given at construction. With a
+/// FixedArenaResource and a single reserveCapacity() at init, the
+/// steady-state cycle (clear, addObject, the comparison and radix sorts,
+/// partialSortCriticalObjects, the view and index queries) does not
+/// allocate. The ParallelSortOptions overloads and the std::vector results
+/// use the heap.
+///
+/// A tracker is not thread-safe. To hand frames from a sensor thread to a
+/// planner thread without locking, use TrackerFrameExchange.
+///
 class AEBObjectTracker {
 public:
+  /// @brief Storage type of the tracked objects.
+  using ObjectContainer = std::pmr::vector<DetectedObject>;
+
   struct Comparators {
     /// @brief Comparator for sorting DetectedObject by collision time.
     /// Handles infinity values and uses distance as tie-breaker.
@@ -78,13 +69,138 @@ public:
     ///
     static bool byThreatLevel(DetectedObject const &first_object,
                               DetectedObject const &second_object);
+
+    /// @brief Comparator used by sortMultiCriteria(): threat level, then
+    /// collision time, then distance.
+    /// @param first_object First DetectedObject to compare.
+    /// @param second_object Second DetectedObject to compare.
+    /// @return true if first_object has higher priority.
+    ///
+    static bool byMultiCriteria(DetectedObject const &first_object,
+                                DetectedObject const &second_object) noexcept;
+  };
+
+  /// @brief Order of the objects after commitFrame().
+  enum class CommitOrder {
+    kAsStaged,      ///< Producer runs concatenated in producer order
+    kCollisionTime, ///< Runs sorted, then merged as byCollisionTime
   };
 
+  /// @brief How the full sorts order the frame.
+  enum class SortMode {
+    kComparison, ///< std::sort with the Comparators (default)
+    kRadixKey,   ///< LSD radix sort on precomputed integer keys
+  };
+
+  /// @brief Create a tracker allocating from the default memory resource.
+  AEBObjectTracker();
+
+  /// @brief Create a tracker allocating all of its storage from resource.
+  /// @param resource Memory resource; must outlive the tracker.
+  explicit AEBObjectTracker(std::pmr::memory_resource *resource);
+
   /// @brief Add a detected object to the tracking system.
   /// @param object DetectedObject to add.
   void addObject(DetectedObject const &object);
 
+  /// @brief Update a tracked object in place with a new measurement.
+  /// @details Recomputes TTC and threat level; the object keeps its position,
+  /// so a previously sorted order may need resortByCollisionTime().
+  /// @param id ID of the object to update.
+  /// @param distance New distance in meters.
+  /// @param relative_velocity New relative velocity in m/s.
+  /// @return false if no object with this ID is tracked.
+  bool updateObject(int id, float distance, float relative_velocity);
+
+  /// @brief Apply a whole frame of measurements to persistent tracks.
+  /// @details Known IDs are updated in place, unknown IDs are added as new
+  /// tracks. Tracks missing from the frame are kept. Enable the ID index to
+  /// make the association O(1) per measurement.
+  /// @param ids Object IDs.
+  /// @param distances Distances in meters.
+  /// @param relative_velocities Relative velocities in m/s.
+  /// @param count Number of measurements in every array.
+  /// @return Number of new tracks added.
+  std::size_t updateFrame(int const *ids, float const *distances,
+                          float const *relative_velocities, std::size_t count);
+
+  /// @brief Add a whole frame of detections with constant-acceleration TTC.
+  /// @details TTC, threat level and ego-compensated relative velocity are
+  /// computed by the vectorized simd::computeCollisionTimes() in chunks on
+  /// the stack; the objects are then appended as by addObject(), without
+  /// computing anything per object again. The accelerations themselves are
+  /// not kept: recordFrame() logs the resulting TTC, so a replay reproduces
+  /// it, but updateObject() recomputes it with constant velocity.
+  /// @param ids Object IDs.
+  /// @param distances Distances in meters.
+  /// @param velocities Velocities in m/s, over ground unless ego is at rest.
+  /// @param accelerations Accelerations in m/s^2, same frame as velocities.
+  /// @param count Number of detections in every array.
+  /// @param ego Ego motion subtracted from velocities and accelerations.
+  void addObjects(int const *ids, float const *distances,
+                  float const *velocities, float const *accelerations,
+                  std::size_t count, EgoMotion const &ego = EgoMotion{});
+
+  /// @brief Replace the tracked objects with a frame staged by several
+  /// producers, then clear the staging buffers.
+  /// @details Call only once every producer has finished the frame. The
+  /// objects are copied with at most one allocation (none once
+  /// reserveCapacity() covers the frame). With CommitOrder::kCollisionTime,
+  /// runs the producers did not sort themselves are sorted, in parallel for
+  /// large frames, and the sorted runs are merged as by mergeSortedRuns():
+  /// the result is ordered as after sortByCollisionTime(), and ties between
+  /// runs go to the lower producer index, so the order is deterministic.
+  /// @param staging Staging buffers holding the frame.
+  /// @param order Order of the committed objects.
+  /// @return Number of committed objects.
+  std::size_t commitFrame(ObjectStaging &staging,
+                          CommitOrder order = CommitOrder::kAsStaged);
+
+  /// @brief Replace the tracked objects with the merge of runs that are
+  /// each sorted by Comparators::byCollisionTime.
+  /// @details Loser-tree merge, O(n log k) for k runs of n objects in
+  /// total; the result is ordered as after sortByCollisionTime(), with ties
+  /// between runs going to the lower run index. The runs must not point
+  /// into this tracker.
+  /// @param runs Sorted runs, e.g. one per sensor.
+  /// @param run_count Number of runs.
+  /// @return Number of tracked objects.
+  std::size_t mergeSortedRuns(ObjectRange const *runs, std::size_t run_count);
+
+  /// @brief Top-K variant: keep only the max_objects most critical objects
+  /// of the sorted runs.
+  /// @details The merge stops after max_objects outputs, O(k + K log k),
+  /// so nothing is spent on the objects that getCriticalObjects() would
+  /// skip. Afterwards the tracker holds exactly those objects, sorted.
+  /// @param runs Sorted runs, e.g. one per sensor.
+  /// @param run_count Number of runs.
+  /// @param max_objects Number of objects to keep (K).
+  /// @return Number of tracked objects.
+  std::size_t mergeSortedRuns(ObjectRange const *runs, std::size_t run_count,
+                              std::size_t max_objects);
+
+  /// @brief Attach a recorder that recordFrame() writes to.
+  /// @details Nothing is recorded while a frame is being built, so adding
+  /// and updating objects costs the same with or without a recorder.
+  /// @param recorder Recorder to attach, or nullptr to detach. Must outlive
+  /// the attachment.
+  void setFrameRecorder(FrameRecorder *recorder) noexcept {
+    recorder_ = recorder;
+  }
+
+  /// @brief Record the current contents as one frame of the log.
+  /// @details Call once the frame is complete. The snapshot covers every
+  /// way objects reach the tracker (addObject(), updateObject(),
+  /// updateFrame(), commitFrame(), mergeSortedRuns(), ...), in their
+  /// current order, so loadLoggedFrame() restores exactly getObjects().
+  /// Does nothing without a recorder.
+  /// @param timestamp_ns Frame timestamp in nanoseconds.
+  void recordFrame(std::uint64_t timestamp_ns);
+
   /// @brief Reserve memory capacity for objects (performance optimization).
+  /// @details Also sizes the ID index (if enabled) and the radix sort
+  /// buffers (in SortMode::kRadixKey), so configure those first when every
+  /// allocation has to happen here.
   /// @param capacity Number of objects to reserve space for.
   void reserveCapacity(std::size_t capacity);
 
@@ -93,7 +209,12 @@ public:
 
   /// @brief Get reference to all tracked objects.
   /// @return Const reference to object vector.
-  std::vector<DetectedObject> const &getObjects() const;
+  ObjectContainer const &getObjects() const;
+
+  /// @brief Memory resource the tracker allocates from.
+  std::pmr::memory_resource *getMemoryResource() const noexcept {
+    return objects_.get_allocator().resource();
+  }
 
   /// @brief Get number of tracked objects.
   /// @return Number of objects.
@@ -105,12 +226,38 @@ public:
 
   /// @brief Sort all objects by collision time (full sort using introsort).
   /// Time complexity: O(n log n), Space: O(log n).
+  /// @details In SortMode::kRadixKey each object is mapped to
+  /// collisionTimeSortKey() and the frame is radix sorted instead: O(n) with
+  /// at most eight passes, Space: O(n) (kept between calls). The order is
+  /// the same as with the comparator, with ties broken by distance.
   void sortByCollisionTime();
 
+  /// @brief Stable sort by collision time, multi-threaded for large frames.
+  /// @details Above options.min_parallel_size the frame is sorted in chunks
+  /// on several threads and merged. The output equals std::stable_sort on
+  /// the calling thread whatever the frame size or thread count.
+  /// @param options Size threshold and thread count.
+  void sortByCollisionTime(ParallelSortOptions const &options);
+
+  /// @brief Re-sort by collision time after small changes (e.g. updateFrame).
+  /// @details Adaptive insertion pass, O(n + inversions) on nearly sorted
+  /// input, which is the common case between consecutive frames. Falls back
+  /// to introsort once the number of moves exceeds a linear budget. Produces
+  /// the same order as sortByCollisionTime() up to ties.
+  void resortByCollisionTime();
+
   /// @brief Sort all objects by threat level (full sort using introsort).-
   /// Time complexity: O(n log n), Space: O(log n).
   void sortByThreatLevel();
 
+  /// @brief Stable sort by threat level, multi-threaded for large frames.
+  /// @details Orders by threatLevelSortKey(), i.e. threat level in 0.001
+  /// buckets, then distance. Being a strict weak order, the result is the
+  /// same for every frame size and thread count; near-equal threat levels
+  /// may be ordered differently than by sortByThreatLevel().
+  /// @param options Size threshold and thread count.
+  void sortByThreatLevel(ParallelSortOptions const &options);
+
   /// @brief Get only the n most critical objects by collision time.
   /// Time complexity: O(n log k) where k = max_objects, Space: O(1).
   /// @param max_objects Maximum number of critical objects to sort (default: 5)
@@ -120,11 +267,32 @@ public:
   void
   partialSortCriticalObjects(std::size_t max_objects = kMaxCriticalObjects);
 
+  /// @brief Partial sort by collision time, multi-threaded for large frames.
+  /// @details The prefix equals the first max_objects objects of a stable
+  /// sort; the remaining objects keep their relative order. The output is
+  /// the same for every frame size and thread count. Below the size
+  /// threshold, up to 8 objects are selected in place without allocating;
+  /// larger K and the parallel path allocate O(n) positions.
+  /// @param max_objects Maximum number of critical objects to sort.
+  /// @param options Size threshold and thread count.
+  void partialSortCriticalObjects(std::size_t max_objects,
+                                  ParallelSortOptions const &options);
+
   /// @brief Multi-criteria sort (full sort using introsort - std::sort),
   /// combining threat level, collision time, and distance.
   /// Time complexity: O(n log n), Space: O(log n).
+  /// @details In SortMode::kRadixKey the criteria are packed into one
+  /// multiCriteriaSortKey() per object and the frame is radix sorted on it:
+  /// O(n), and the order is well defined instead of depending on the
+  /// non-transitive epsilon comparison.
   void sortMultiCriteria();
 
+  /// @brief Stable multi-criteria sort, multi-threaded for large frames.
+  /// @details Orders by multiCriteriaSortKey() like SortMode::kRadixKey, so
+  /// the result is the same for every frame size and thread count.
+  /// @param options Size threshold and thread count.
+  void sortMultiCriteria(ParallelSortOptions const &options);
+
   /// @brief Get the most critical objects (assumes partialSortCriticalObjects
   /// was called).
   /// @param max_objects Maximum number of objects to return (default: 5).
@@ -141,11 +309,86 @@ public:
   std::vector<DetectedObject>
   getObjectsWithinTimeThreshold(float threshold_seconds) const;
 
+  /// @brief getCriticalObjects() allocating the result from resource.
+  /// @param max_objects Maximum number of objects to return.
+  /// @param resource Memory resource for the result, e.g. a per-frame
+  /// FixedArenaResource released at the end of the frame.
+  /// @return Critical objects; exactly one allocation.
+  ObjectContainer getCriticalObjects(std::size_t max_objects,
+                                     std::pmr::memory_resource *resource) const;
+
+  /// @brief getObjectsWithinTimeThreshold() allocating the result from
+  /// resource.
+  /// @param threshold_seconds Time threshold in seconds.
+  /// @param resource Memory resource for the result.
+  /// @return Objects within threshold; at most one allocation of exactly
+  /// the needed size.
+  ObjectContainer
+  getObjectsWithinTimeThreshold(float threshold_seconds,
+                                std::pmr::memory_resource *resource) const;
+
+  /// @brief Allocation-free variant of getCriticalObjects().
+  /// @param max_objects Maximum number of objects in the view.
+  /// @return View over the sorted prefix of the tracked objects (assumes
+  /// partialSortCriticalObjects was called). Invalidated by any
+  /// modification of the tracker.
+  ObjectRange getCriticalObjectsView(std::size_t max_objects) const noexcept;
+
+  /// @brief Allocation-free variant of getObjectsWithinTimeThreshold().
+  /// @param threshold_seconds Time threshold in seconds.
+  /// @return Lazy filtered view over the tracked objects. Invalidated by any
+  /// modification of the tracker.
+  ThresholdObjectRange
+  getObjectsWithinTimeThresholdView(float threshold_seconds) const noexcept;
+
+  /// @brief Get positions of objects within critical collision time
+  /// threshold.
+  /// @param threshold_seconds Time threshold in seconds.
+  /// @param indices Output positions in ascending order; its capacity is
+  /// reused between calls, so steady-state calls do not allocate.
+  /// @return Number of objects within threshold.
+  std::size_t
+  getObjectIndicesWithinTimeThreshold(float threshold_seconds,
+                                      std::vector<std::size_t> &indices) const;
+
   /// @brief Find object by ID.
   /// @param id Object ID to search for.
   /// @return Iterator to found object or end() if not found.
   auto findObjectById(int id) const noexcept
-      -> std::vector<DetectedObject>::const_iterator;
+      -> ObjectContainer::const_iterator;
+
+  /// @brief Look up the positions of many IDs at once (e.g. every track ID
+  /// of the previous frame). O(1) per ID with the ID index enabled.
+  /// @param ids Object IDs to search for.
+  /// @param positions Output positions in getObjects(), one per ID, or
+  /// ObjectIdIndex::kNotFound; its capacity is reused between calls.
+  void findObjectsByIds(std::vector<int> const &ids,
+                        std::vector<std::size_t> &positions) const;
+
+  /// @brief Enable or disable the ID hash index used by findObjectById().
+  /// @details While enabled, the index is maintained by addObject(), every
+  /// sort and clear(). Sorting pays an O(n) rebuild.
+  /// @param enabled true to build and maintain the index.
+  void enableIdIndex(bool enabled);
+
+  /// @brief Select the algorithm used by the full sorts.
+  /// @param mode Comparison sort or radix sort on integer keys.
+  void setSortMode(SortMode mode) noexcept { sort_mode_ = mode; }
+
+  /// @brief Algorithm used by the full sorts.
+  SortMode getSortMode() const noexcept { return sort_mode_; }
+
+  /// @brief Check if the ID hash index is enabled.
+  bool isIdIndexEnabled() const noexcept { return id_index_enabled_; }
+
+  /// @brief Maintain the most critical objects incrementally on insert.
+  /// @details While enabled, addObject() keeps a bounded set of the
+  /// max_objects most critical objects by Comparators::byCollisionTime, and
+  /// getCriticalObjects() / getCriticalObjectsView() for up to max_objects
+  /// objects read that set in O(K). The result is then correct whether or
+  /// not partialSortCriticalObjects() was called.
+  /// @param max_objects Size of the maintained set (K); 0 disables the mode.
+  void setIncrementalCriticalObjects(std::size_t max_objects);
 
   /// @brief Check if any object has critical collision time.
   /// @param threshold_seconds Critical time threshold in seconds
@@ -159,12 +402,65 @@ public:
   ///
   bool hasCriticalObjects(float threshold_seconds = 2.0f) const;
 
+  /// @brief Classify all objects into TTC threshold bands in a single pass.
+  /// @details Answers hasCriticalObjects() and getObjectsWithinTimeThreshold()
+  /// for every threshold of a control cycle at once.
+  /// @param thresholds TTC band upper bounds in seconds, sorted ascending.
+  /// @param classification Result; its allocated capacity is reused.
+  /// @param collect_indices Whether to record per-band index lists.
+  void classifyByThresholds(std::vector<float> const &thresholds,
+                            ThresholdClassification &classification,
+                            bool collect_indices = false) const;
+
+  /// @brief Classify all objects into TTC threshold bands in a single pass.
+  /// @param thresholds TTC band upper bounds in seconds, sorted ascending.
+  /// @param collect_indices Whether to record per-band index lists.
+  /// @return Per-band counts, first matches and optional index lists.
+  ThresholdClassification
+  classifyByThresholds(std::vector<float> const &thresholds,
+                       bool collect_indices = false) const;
+
+  /// @brief Predict the most critical objects at every step of a horizon.
+  /// @details One sweep over the tracked objects extrapolates each of them
+  /// to every step; see CollisionForecast. Equivalent to running
+  /// partialSortCriticalObjects() on an extrapolated copy of the frame per
+  /// step, without building the copies. Objects added with an acceleration
+  /// (addObjects()) are extrapolated with it; see CollisionForecast.
+  /// @param horizon Steps and K.
+  /// @param forecast Result; its allocated storage is reused.
+  /// @param ego_acceleration Ego acceleration in m/s^2 assumed over the
+  /// horizon (negative = braking).
+  void forecastCriticalObjects(ForecastHorizon const &horizon,
+                               CollisionForecast &forecast,
+                               float ego_acceleration = 0.0f) const;
+
   /// @brief Print objects for debugging.
   /// @param title Optional title for the output.
   void printObjects(std::string const &title = "") const;
 
 private:
-  std::vector<DetectedObject> objects_; ///< Container for detected objects
+  ObjectContainer objects_;         ///< Container for detected objects
+  ObjectIdIndex id_index_;          ///< ID -> position in objects_
+  bool id_index_enabled_{false};    ///< Whether id_index_ is maintained
+  CriticalObjectSet critical_set_;  ///< Incremental top-K (K may be 0)
+  SortMode sort_mode_{SortMode::kComparison}; ///< Algorithm of full sorts
+  RadixKeySorter radix_sorter_;               ///< Scratch for kRadixKey
+  std::pmr::vector<std::uint64_t> sort_keys_; ///< One key per object
+  ObjectContainer sort_scratch_;              ///< Gather buffer
+  KWayMerger merger_;                         ///< Sorted-run merges
+  FrameRecorder *recorder_{nullptr};          ///< Optional input capture
+
+  /// @brief Reorder objects_ by ascending sort_keys_ (radix sort).
+  void sortBySortKeys();
+
+  /// @brief Restore derived state after objects_ has been reordered.
+  void onObjectsReordered();
+
+  /// @brief Keep critical_set_ correct after objects_ changed in place.
+  void updateCriticalSet(DetectedObject const &updated);
+
+  /// @brief Refill critical_set_ from all tracked objects.
+  void rebuildCriticalSet();
 
   static constexpr std::size_t kMaxCriticalObjects =
       5U; ///< Default maximum critical objects to track.
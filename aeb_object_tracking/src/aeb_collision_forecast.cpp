@@ -0,0 +1,88 @@
+/// @file aeb_collision_forecast.cpp
+
+#include "../include/aeb_collision_forecast.h"
+#include "../include/aeb_collision_model.h"
+#include "../include/aeb_simd.h"
+#include <algorithm>  // for min
+#include <array>      // for array
+
+namespace aeb {
+namespace object_tracking {
+
+CollisionForecast::CollisionForecast(std::pmr::memory_resource *resource)
+    : resource_{resource}, steps_{resource} {
+  reset(horizon_);
+}
+
+void CollisionForecast::reset(ForecastHorizon const &horizon,
+                              float ego_acceleration) {
+  horizon_ = horizon;
+  relative_acceleration_ = -ego_acceleration;
+  if (steps_.size() > horizon_.step_count) {
+    steps_.erase(steps_.begin() +
+                     static_cast<std::ptrdiff_t>(horizon_.step_count),
+                 steps_.end());
+  }
+  for (auto &step : steps_) {
+    step.setCapacity(horizon_.max_objects);
+  }
+  while (steps_.size() < horizon_.step_count) {
+    steps_.emplace_back(horizon_.max_objects, resource_);
+  }
+}
+
+void CollisionForecast::project(ObjectRange objects) {
+  std::array<int, kChunkSize> ids;
+  std::array<float, kChunkSize> distances;
+  std::array<float, kChunkSize> relative_velocities;
+  std::array<float, kChunkSize> relative_accelerations;
+  std::array<float, kChunkSize> collision_times;
+  std::array<float, kChunkSize> threat_levels;
+  std::array<float, kChunkSize> projected_distances;
+  std::array<float, kChunkSize> projected_velocities;
+  std::array<float, kChunkSize> projected_collision_times;
+  std::array<float, kChunkSize> projected_threat_levels;
+  // Without ego acceleration the stored TTC is valid as is.
+  const bool use_stored_collision_times = relative_acceleration_ == 0.0f;
+
+  for (std::size_t begin = 0U; begin < objects.size(); begin += kChunkSize) {
+    const std::size_t chunk = std::min(kChunkSize, objects.size() - begin);
+    for (std::size_t i = 0U; i < chunk; ++i) {
+      DetectedObject const &object = objects[begin + i];
+      ids[i] = object.getId();
+      distances[i] = object.getDistance();
+      relative_velocities[i] = object.getRelativeVelocity();
+      collision_times[i] = object.getCollisionTime();
+      // Objects keep only their TTC; recover the acceleration behind it.
+      relative_accelerations[i] =
+          impliedRelativeAcceleration(distances[i], relative_velocities[i],
+                                      collision_times[i]) +
+          relative_acceleration_;
+    }
+    if (!use_stored_collision_times) {
+      // Current TTC including the assumed ego acceleration.
+      simd::computeCollisionTimes(
+          distances.data(), relative_velocities.data(),
+          relative_accelerations.data(), EgoMotion{},
+          relative_velocities.data(), collision_times.data(),
+          threat_levels.data(), chunk);
+    }
+
+    for (std::size_t s = 0U; s < horizon_.step_count; ++s) {
+      simd::projectCollisionTimes(
+          distances.data(), relative_velocities.data(),
+          relative_accelerations.data(), collision_times.data(), chunk,
+          stepTime(s), projected_distances.data(), projected_velocities.data(),
+          projected_collision_times.data(), projected_threat_levels.data());
+      CriticalObjectSet &step = steps_[s];
+      for (std::size_t i = 0U; i < chunk; ++i) {
+        step.offer(DetectedObject::fromPrecomputed(
+            ids[i], projected_distances[i], projected_velocities[i],
+            projected_collision_times[i], projected_threat_levels[i]));
+      }
+    }
+  }
+}
+
+} // namespace object_tracking
+} // namespace aeb
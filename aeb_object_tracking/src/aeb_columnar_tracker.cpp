@@ -0,0 +1,304 @@
+/// @file aeb_columnar_tracker.cpp
+
+#include "../include/aeb_columnar_tracker.h"
+#include "../include/aeb_simd.h"
+#include <algorithm>  // for sort, partial_sort, min, find
+#include <cmath>      // for isinf, abs
+#include <iomanip>    // for operator<<, setprecision
+#include <iostream>   // for basic_ostream, operator<<, cout, fixed
+#include <iterator>   // for distance
+#include <numeric>    // for iota
+
+namespace aeb {
+namespace object_tracking {
+
+namespace {
+
+using diff_t = std::vector<std::size_t>::difference_type;
+
+/// @brief Column equivalent of AEBObjectTracker::Comparators::byCollisionTime.
+bool collisionTimeLess(float first_collision_time, float first_distance,
+                       float second_collision_time,
+                       float second_distance) noexcept {
+  if (std::isinf(first_collision_time) && std::isinf(second_collision_time)) {
+    return first_distance < second_distance;
+  }
+  if (std::isinf(first_collision_time)) {
+    return false;
+  }
+  if (std::isinf(second_collision_time)) {
+    return true;
+  }
+  return first_collision_time < second_collision_time;
+}
+
+/// @brief Column equivalent of AEBObjectTracker::Comparators::byThreatLevel.
+bool threatLevelLess(float first_threat_level, float first_distance,
+                     float second_threat_level,
+                     float second_distance) noexcept {
+  constexpr float kThreatLevelFactor{0.001f};
+
+  if (std::abs(first_threat_level - second_threat_level) <
+      kThreatLevelFactor) {
+    return first_distance < second_distance;
+  }
+  return first_threat_level > second_threat_level;
+}
+
+/// @brief Column equivalent of AEBObjectTracker's multi-criteria comparator.
+bool multiCriteriaLess(float first_threat_level, float first_collision_time,
+                       float first_distance, float second_threat_level,
+                       float second_collision_time,
+                       float second_distance) noexcept {
+  constexpr float threat_epsilon = 0.01f;
+  constexpr float time_epsilon = 0.1f;
+
+  if (std::abs(first_threat_level - second_threat_level) > threat_epsilon) {
+    return first_threat_level > second_threat_level;
+  }
+  if (!std::isinf(first_collision_time) &&
+      !std::isinf(second_collision_time)) {
+    if (std::abs(first_collision_time - second_collision_time) >
+        time_epsilon) {
+      return first_collision_time < second_collision_time;
+    }
+  }
+  return first_distance < second_distance;
+}
+
+/// @brief Gather column[permutation[i]] into scratch, then swap it in.
+template <typename T>
+void gatherColumn(std::vector<T> &column,
+                  std::vector<std::size_t> const &permutation,
+                  std::vector<T> &scratch) {
+  scratch.resize(column.size());
+  for (std::size_t i = 0; i < permutation.size(); ++i) {
+    scratch[i] = column[permutation[i]];
+  }
+  column.swap(scratch);
+}
+
+} // namespace
+
+void ColumnarObjectTracker::addObject(DetectedObject const &object) {
+  ids_.push_back(object.getId());
+  distances_.push_back(object.getDistance());
+  relative_velocities_.push_back(object.getRelativeVelocity());
+  collision_times_.push_back(object.getCollisionTime());
+  threat_levels_.push_back(object.getThreatLevel());
+}
+
+void ColumnarObjectTracker::addObjects(int const *ids, float const *distances,
+                                       float const *relative_velocities,
+                                       std::size_t count) {
+  const std::size_t offset = size();
+
+  ids_.insert(ids_.end(), ids, ids + count);
+  distances_.insert(distances_.end(), distances, distances + count);
+  relative_velocities_.insert(relative_velocities_.end(), relative_velocities,
+                              relative_velocities + count);
+  collision_times_.resize(offset + count);
+  threat_levels_.resize(offset + count);
+
+  simd::computeCollisionTimes(distances_.data() + offset,
+                              relative_velocities_.data() + offset,
+                              collision_times_.data() + offset,
+                              threat_levels_.data() + offset, count);
+}
+
+void ColumnarObjectTracker::addObjects(int const *ids, float const *distances,
+                                       float const *velocities,
+                                       float const *accelerations,
+                                       std::size_t count,
+                                       EgoMotion const &ego) {
+  const std::size_t offset = size();
+
+  ids_.insert(ids_.end(), ids, ids + count);
+  distances_.insert(distances_.end(), distances, distances + count);
+  relative_velocities_.insert(relative_velocities_.end(), velocities,
+                              velocities + count);
+  collision_times_.resize(offset + count);
+  threat_levels_.resize(offset + count);
+
+  float *relative_velocities = relative_velocities_.data() + offset;
+  simd::computeCollisionTimes(distances_.data() + offset, relative_velocities,
+                              accelerations, ego, relative_velocities,
+                              collision_times_.data() + offset,
+                              threat_levels_.data() + offset, count);
+}
+
+void ColumnarObjectTracker::reserveCapacity(std::size_t capacity) {
+  ids_.reserve(capacity);
+  distances_.reserve(capacity);
+  relative_velocities_.reserve(capacity);
+  collision_times_.reserve(capacity);
+  threat_levels_.reserve(capacity);
+  permutation_.reserve(capacity);
+  float_scratch_.reserve(capacity);
+  id_scratch_.reserve(capacity);
+}
+
+void ColumnarObjectTracker::clear() noexcept {
+  ids_.clear();
+  distances_.clear();
+  relative_velocities_.clear();
+  collision_times_.clear();
+  threat_levels_.clear();
+}
+
+std::size_t ColumnarObjectTracker::size() const { return ids_.size(); }
+
+bool ColumnarObjectTracker::empty() const { return ids_.empty(); }
+
+DetectedObject ColumnarObjectTracker::getObject(std::size_t index) const {
+  return DetectedObject::fromPrecomputed(
+      ids_[index], distances_[index], relative_velocities_[index],
+      collision_times_[index], threat_levels_[index]);
+}
+
+void ColumnarObjectTracker::sortByCollisionTime() {
+  permutation_.resize(size());
+  std::iota(permutation_.begin(), permutation_.end(), std::size_t{0});
+  std::sort(permutation_.begin(), permutation_.end(),
+            [this](std::size_t first, std::size_t second) noexcept {
+              return collisionTimeLess(
+                  collision_times_[first], distances_[first],
+                  collision_times_[second], distances_[second]);
+            });
+  applyPermutation();
+}
+
+void ColumnarObjectTracker::sortByThreatLevel() {
+  permutation_.resize(size());
+  std::iota(permutation_.begin(), permutation_.end(), std::size_t{0});
+  std::sort(permutation_.begin(), permutation_.end(),
+            [this](std::size_t first, std::size_t second) noexcept {
+              return threatLevelLess(threat_levels_[first], distances_[first],
+                                     threat_levels_[second],
+                                     distances_[second]);
+            });
+  applyPermutation();
+}
+
+void ColumnarObjectTracker::partialSortCriticalObjects(
+    std::size_t max_objects) {
+  if (empty())
+    return;
+
+  const std::size_t num_to_sort = std::min(max_objects, size());
+
+  permutation_.resize(size());
+  std::iota(permutation_.begin(), permutation_.end(), std::size_t{0});
+  std::partial_sort(permutation_.begin(),
+                    permutation_.begin() + static_cast<diff_t>(num_to_sort),
+                    permutation_.end(),
+                    [this](std::size_t first, std::size_t second) noexcept {
+                      return collisionTimeLess(
+                          collision_times_[first], distances_[first],
+                          collision_times_[second], distances_[second]);
+                    });
+  applyPermutation();
+}
+
+void ColumnarObjectTracker::sortMultiCriteria() {
+  permutation_.resize(size());
+  std::iota(permutation_.begin(), permutation_.end(), std::size_t{0});
+  std::sort(permutation_.begin(), permutation_.end(),
+            [this](std::size_t first, std::size_t second) noexcept {
+              return multiCriteriaLess(
+                  threat_levels_[first], collision_times_[first],
+                  distances_[first], threat_levels_[second],
+                  collision_times_[second], distances_[second]);
+            });
+  applyPermutation();
+}
+
+std::vector<DetectedObject>
+ColumnarObjectTracker::getCriticalObjects(std::size_t max_objects) const {
+  const std::size_t num_objects = std::min(max_objects, size());
+
+  std::vector<DetectedObject> critical_objects;
+  critical_objects.reserve(num_objects);
+  for (std::size_t i = 0; i < num_objects; ++i) {
+    critical_objects.push_back(getObject(i));
+  }
+  return critical_objects;
+}
+
+std::vector<DetectedObject> ColumnarObjectTracker::getObjectsWithinTimeThreshold(
+    float threshold_seconds) const {
+  std::vector<std::size_t> indices;
+  getObjectIndicesWithinTimeThreshold(threshold_seconds, indices);
+
+  std::vector<DetectedObject> critical_objects;
+  critical_objects.reserve(indices.size());
+  for (const std::size_t index : indices) {
+    critical_objects.push_back(getObject(index));
+  }
+  return critical_objects;
+}
+
+std::size_t ColumnarObjectTracker::getObjectIndicesWithinTimeThreshold(
+    float threshold_seconds, std::vector<std::size_t> &indices) const {
+  indices.resize(size());
+  const std::size_t count = simd::filterWithinThreshold(
+      collision_times_.data(), size(), threshold_seconds, indices.data());
+  indices.resize(count);
+  return count;
+}
+
+std::size_t ColumnarObjectTracker::findObjectById(int id) const noexcept {
+  const auto found = std::find(ids_.begin(), ids_.end(), id);
+  if (found == ids_.end()) {
+    return kNotFound;
+  }
+  return static_cast<std::size_t>(std::distance(ids_.begin(), found));
+}
+
+bool ColumnarObjectTracker::hasCriticalObjects(float threshold_seconds) const {
+  return simd::anyWithinThreshold(collision_times_.data(), size(),
+                                  threshold_seconds);
+}
+
+void ColumnarObjectTracker::classifyByThresholds(
+    std::vector<float> const &thresholds,
+    ThresholdClassification &classification, bool collect_indices) const {
+  classification.reset(thresholds, collect_indices);
+  for (std::size_t i = 0; i < collision_times_.size(); ++i) {
+    classification.record(i, collision_times_[i]);
+  }
+}
+
+void ColumnarObjectTracker::printObjects(std::string const &title) const {
+  if (!title.empty()) {
+    std::cout << "\n=== " << title << " ===\n";
+  }
+
+  std::cout << std::fixed << std::setprecision(2);
+  std::cout << "ID\tDist(m)\tRelVel(m/s)\tTTC(s)\tThreat\n";
+  std::cout << "----------------------------------------\n";
+
+  for (std::size_t i = 0; i < size(); ++i) {
+    std::cout << ids_[i] << "\t" << distances_[i] << "\t"
+              << relative_velocities_[i] << "\t\t";
+
+    if (std::isinf(collision_times_[i])) {
+      std::cout << "INF";
+    } else {
+      std::cout << collision_times_[i];
+    }
+
+    std::cout << "\t" << threat_levels_[i] << "\n";
+  }
+}
+
+void ColumnarObjectTracker::applyPermutation() {
+  gatherColumn(ids_, permutation_, id_scratch_);
+  gatherColumn(distances_, permutation_, float_scratch_);
+  gatherColumn(relative_velocities_, permutation_, float_scratch_);
+  gatherColumn(collision_times_, permutation_, float_scratch_);
+  gatherColumn(threat_levels_, permutation_, float_scratch_);
+}
+
+} // namespace object_tracking
+} // namespace aeb
@@ -0,0 +1,59 @@
+/// @file aeb_critical_object_set.cpp
+
+#include "../include/aeb_critical_object_set.h"
+#include <algorithm>  // for upper_bound, find_if
+#include "../include/aeb_tracker.h"
+
+namespace aeb {
+namespace object_tracking {
+
+CriticalObjectSet::CriticalObjectSet(std::size_t capacity,
+                                     std::pmr::memory_resource *resource)
+    : objects_{resource} {
+  setCapacity(capacity);
+}
+
+void CriticalObjectSet::setCapacity(std::size_t capacity) {
+  capacity_ = capacity;
+  objects_.clear();
+  objects_.reserve(capacity);
+}
+
+bool CriticalObjectSet::admits(DetectedObject const &object) const {
+  if (capacity_ == 0U) {
+    return false;
+  }
+  return !full() || AEBObjectTracker::Comparators::byCollisionTime(
+                        object, objects_.back());
+}
+
+bool CriticalObjectSet::offer(DetectedObject const &object) {
+  if (!admits(object)) {
+    return false;
+  }
+  if (full()) {
+    objects_.pop_back();
+  }
+  // upper_bound keeps insertion order among equally critical objects.
+  const auto position =
+      std::upper_bound(objects_.begin(), objects_.end(), object,
+                       AEBObjectTracker::Comparators::byCollisionTime);
+  objects_.insert(position, object);
+  return true;
+}
+
+bool CriticalObjectSet::remove(int id) {
+  const auto found =
+      std::find_if(objects_.begin(), objects_.end(),
+                   [id](DetectedObject const &obj) noexcept {
+                     return obj.getId() == id;
+                   });
+  if (found == objects_.end()) {
+    return false;
+  }
+  objects_.erase(found);
+  return true;
+}
+
+} // namespace object_tracking
+} // namespace aeb
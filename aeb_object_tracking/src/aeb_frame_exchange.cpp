@@ -0,0 +1,36 @@
+/// @file aeb_frame_exchange.cpp
+
+#include "../include/aeb_frame_exchange.h"
+
+namespace aeb {
+namespace object_tracking {
+
+TrackerFrameExchange::TrackerFrameExchange(
+    std::pmr::memory_resource *resource)
+    : frames_{{AEBObjectTracker(resource), AEBObjectTracker(resource),
+               AEBObjectTracker(resource)}} {}
+
+std::uint64_t TrackerFrameExchange::publish() noexcept {
+  sequences_[back_] = ++published_;
+  // Release makes the frame contents visible to the consumer's acquire;
+  // acquire makes the consumer's reads of the returned slot happen before
+  // the producer reuses it.
+  const std::uint8_t previous = middle_.exchange(
+      static_cast<std::uint8_t>(back_ | kFreshFlag), std::memory_order_acq_rel);
+  back_ = static_cast<std::uint8_t>(previous & kIndexMask);
+  return published_;
+}
+
+bool TrackerFrameExchange::acquire() noexcept {
+  if ((middle_.load(std::memory_order_relaxed) & kFreshFlag) == 0U) {
+    return false;
+  }
+  // Only the consumer clears the flag, so the slot is still fresh here.
+  const std::uint8_t previous =
+      middle_.exchange(front_, std::memory_order_acq_rel);
+  front_ = static_cast<std::uint8_t>(previous & kIndexMask);
+  return true;
+}
+
+} // namespace object_tracking
+} // namespace aeb
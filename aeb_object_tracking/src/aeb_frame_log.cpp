@@ -0,0 +1,188 @@
+/// @file aeb_frame_log.cpp
+
+#include "../include/aeb_frame_log.h"
+#include "../include/aeb_tracker.h"
+#include <cstring>   // for memcpy, memcmp
+#include <iterator>  // for istreambuf_iterator
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>     // for open, O_RDONLY
+#include <sys/mman.h>  // for mmap, munmap, madvise
+#include <sys/stat.h>  // for fstat
+#include <unistd.h>    // for close
+#define AEB_FRAME_LOG_MMAP 1
+#endif
+
+namespace aeb {
+namespace object_tracking {
+
+namespace {
+
+constexpr char kMagic[8] = {'A', 'E', 'B', 'F', 'L', 'O', 'G', '\0'};
+constexpr std::uint32_t kVersion = 2U;
+
+struct FileHeader {
+  char magic[8];
+  std::uint32_t version;
+  std::uint32_t record_size;
+};
+
+struct FrameHeader {
+  std::uint64_t timestamp_ns;
+  std::uint32_t object_count;
+  std::uint32_t reserved;
+};
+
+static_assert(sizeof(FileHeader) == 16U, "File header is 16 bytes");
+static_assert(sizeof(FrameHeader) == 16U, "Frame header is 16 bytes");
+
+template <typename T> void writeRaw(std::ofstream &file, T const *data,
+                                    std::size_t count) {
+  file.write(reinterpret_cast<char const *>(data),
+             static_cast<std::streamsize>(sizeof(T) * count));
+}
+
+} // namespace
+
+FrameRecorder::FrameRecorder(std::string const &path)
+    : file_{path, std::ios::binary | std::ios::trunc} {
+  FileHeader header{};
+  std::memcpy(header.magic, kMagic, sizeof(kMagic));
+  header.version = kVersion;
+  header.record_size = static_cast<std::uint32_t>(sizeof(LoggedObject));
+  writeRaw(file_, &header, 1U);
+}
+
+void FrameRecorder::record(DetectedObject const &object) {
+  pending_.push_back(LoggedObject::fromDetectedObject(object));
+}
+
+void FrameRecorder::record(ObjectRange objects) {
+  for (auto const &object : objects) {
+    record(object);
+  }
+}
+
+void FrameRecorder::endFrame(std::uint64_t timestamp_ns) {
+  const FrameHeader header{timestamp_ns,
+                           static_cast<std::uint32_t>(pending_.size()), 0U};
+  writeRaw(file_, &header, 1U);
+  writeRaw(file_, pending_.data(), pending_.size());
+  pending_.clear();
+  ++frames_;
+}
+
+void FrameRecorder::endFrame(ObjectRange objects,
+                             std::uint64_t timestamp_ns) {
+  record(objects);
+  endFrame(timestamp_ns);
+}
+
+FrameLogReader::~FrameLogReader() { close(); }
+
+bool FrameLogReader::open(std::string const &path) {
+  close();
+#if defined(AEB_FRAME_LOG_MMAP)
+  const int fd = ::open(path.c_str(), O_RDONLY);
+  if (fd < 0) {
+    return false;
+  }
+  struct stat info {};
+  if (::fstat(fd, &info) != 0 || info.st_size <= 0) {
+    ::close(fd);
+    return false;
+  }
+  size_ = static_cast<std::size_t>(info.st_size);
+  void *mapping = ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+  ::close(fd); // The mapping keeps the file referenced.
+  if (mapping == MAP_FAILED) {
+    size_ = 0U;
+    return false;
+  }
+  // Replay reads front to back: let the kernel read ahead aggressively.
+  static_cast<void>(::madvise(mapping, size_, MADV_SEQUENTIAL));
+  data_ = static_cast<unsigned char const *>(mapping);
+  mapped_ = true;
+#else
+  std::ifstream file(path, std::ios::binary);
+  if (!file) {
+    return false;
+  }
+  owned_.assign(std::istreambuf_iterator<char>(file),
+                std::istreambuf_iterator<char>());
+  if (owned_.empty()) {
+    return false;
+  }
+  data_ = owned_.data();
+  size_ = owned_.size();
+#endif
+  if (!index()) {
+    close();
+    return false;
+  }
+  return true;
+}
+
+void FrameLogReader::close() noexcept {
+#if defined(AEB_FRAME_LOG_MMAP)
+  if (mapped_) {
+    ::munmap(const_cast<unsigned char *>(data_), size_);
+  }
+#endif
+  data_ = nullptr;
+  size_ = 0U;
+  mapped_ = false;
+  owned_.clear();
+  frame_offsets_.clear();
+  object_count_ = 0U;
+}
+
+LoggedFrame FrameLogReader::frame(std::size_t index) const noexcept {
+  const std::size_t offset = frame_offsets_[index];
+  FrameHeader header{};
+  std::memcpy(&header, data_ + offset, sizeof(header));
+  // Records start 4-byte aligned: the mapping is page aligned and every
+  // header and record size is a multiple of 4.
+  return LoggedFrame{header.timestamp_ns,
+                     reinterpret_cast<LoggedObject const *>(
+                         data_ + offset + sizeof(FrameHeader)),
+                     header.object_count};
+}
+
+bool FrameLogReader::index() {
+  FileHeader header{};
+  if (size_ < sizeof(header)) {
+    return false;
+  }
+  std::memcpy(&header, data_, sizeof(header));
+  if (std::memcmp(header.magic, kMagic, sizeof(kMagic)) != 0 ||
+      header.version != kVersion ||
+      header.record_size != sizeof(LoggedObject)) {
+    return false;
+  }
+
+  std::size_t offset = sizeof(FileHeader);
+  while (size_ - offset >= sizeof(FrameHeader)) {
+    FrameHeader frame_header{};
+    std::memcpy(&frame_header, data_ + offset, sizeof(frame_header));
+    const std::size_t records_size =
+        std::size_t{frame_header.object_count} * sizeof(LoggedObject);
+    if (size_ - offset - sizeof(FrameHeader) < records_size) {
+      break; // Truncated last frame.
+    }
+    frame_offsets_.push_back(offset);
+    object_count_ += frame_header.object_count;
+    offset += sizeof(FrameHeader) + records_size;
+  }
+  return true;
+}
+
+void loadLoggedFrame(LoggedFrame const &frame, AEBObjectTracker &tracker) {
+  tracker.clear();
+  for (std::size_t i = 0; i < frame.object_count; ++i) {
+    tracker.addObject(frame.objects[i].toDetectedObject());
+  }
+}
+
+} // namespace object_tracking
+} // namespace aeb
@@ -0,0 +1,38 @@
+/// @file aeb_kway_merge.cpp
+
+#include "../include/aeb_kway_merge.h"
+
+namespace aeb {
+namespace object_tracking {
+
+namespace {
+
+/// Leaves of a complete tree over run_count runs.
+std::size_t leafCount(std::size_t run_count) noexcept {
+  std::size_t leaves = 1U;
+  while (leaves < run_count) {
+    leaves *= 2U;
+  }
+  return leaves;
+}
+
+} // namespace
+
+KWayMerger::KWayMerger(std::pmr::memory_resource *resource)
+    : runs_{resource}, cursors_{resource}, losers_{resource} {}
+
+void KWayMerger::reserve(std::size_t run_count) {
+  runs_.reserve(run_count);
+  cursors_.reserve(run_count);
+  losers_.reserve(leafCount(run_count));
+}
+
+void KWayMerger::reset(std::size_t run_count) {
+  runs_.assign(run_count, ObjectRange());
+  cursors_.assign(run_count, 0U);
+  leaves_ = leafCount(run_count);
+  losers_.assign(leaves_, 0U);
+}
+
+} // namespace object_tracking
+} // namespace aeb
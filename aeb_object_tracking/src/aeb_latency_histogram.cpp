@@ -0,0 +1,148 @@
+/// @file aeb_latency_histogram.cpp
+
+#include "../include/aeb_latency_histogram.h"
+#include <algorithm>  // for min, max
+#include <cmath>      // for ceil
+#include <iomanip>    // for operator<<, setprecision
+#include <iostream>   // for operator<<, basic_ostream, cout
+
+namespace aeb {
+namespace object_tracking {
+
+namespace {
+
+constexpr std::uint64_t kSubBucketCount = std::uint64_t{1}
+                                          << LatencyHistogram::kPrecisionBits;
+/// Values below this are their own bucket.
+constexpr std::uint64_t kExactLimit = 2U * kSubBucketCount;
+/// Buckets needed to cover the whole uint64_t range.
+constexpr std::uint64_t kBucketCount =
+    (64U - LatencyHistogram::kPrecisionBits + 1U) * kSubBucketCount;
+
+/// @brief Index of the most significant set bit (value must be non-zero).
+unsigned mostSignificantBit(std::uint64_t value) noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+  return 63U - static_cast<unsigned>(__builtin_clzll(value));
+#else
+  unsigned bit = 0U;
+  while ((value >>= 1U) != 0U) {
+    ++bit;
+  }
+  return bit;
+#endif
+}
+
+std::uint64_t bucketIndex(std::uint64_t value) noexcept {
+  if (value < kExactLimit) {
+    return value;
+  }
+  const unsigned shift =
+      mostSignificantBit(value) - LatencyHistogram::kPrecisionBits;
+  return shift * kSubBucketCount + (value >> shift);
+}
+
+/// @brief Largest value that maps to the bucket.
+std::uint64_t bucketUpperBound(std::uint64_t index) noexcept {
+  if (index < kExactLimit) {
+    return index;
+  }
+  const std::uint64_t shift = index / kSubBucketCount - 1U;
+  const std::uint64_t sub_bucket = index - shift * kSubBucketCount;
+  return (sub_bucket << shift) + ((std::uint64_t{1} << shift) - 1U);
+}
+
+} // namespace
+
+LatencyHistogram::LatencyHistogram() : buckets_(kBucketCount, 0U) {}
+
+void LatencyHistogram::record(std::uint64_t nanoseconds) noexcept {
+  ++buckets_[bucketIndex(nanoseconds)];
+  min_ = (count_ == 0U) ? nanoseconds : std::min(min_, nanoseconds);
+  max_ = std::max(max_, nanoseconds);
+  sum_ += static_cast<double>(nanoseconds);
+  ++count_;
+}
+
+void LatencyHistogram::merge(LatencyHistogram const &other) noexcept {
+  if (other.count_ == 0U) {
+    return;
+  }
+  for (size_t i = 0; i < buckets_.size(); ++i) {
+    buckets_[i] += other.buckets_[i];
+  }
+  min_ = (count_ == 0U) ? other.min_ : std::min(min_, other.min_);
+  max_ = std::max(max_, other.max_);
+  sum_ += other.sum_;
+  count_ += other.count_;
+}
+
+void LatencyHistogram::reset() noexcept {
+  std::fill(buckets_.begin(), buckets_.end(), 0U);
+  count_ = 0U;
+  min_ = 0U;
+  max_ = 0U;
+  sum_ = 0.0;
+}
+
+double LatencyHistogram::mean() const noexcept {
+  return count_ == 0U ? 0.0 : sum_ / static_cast<double>(count_);
+}
+
+std::uint64_t LatencyHistogram::valueAtQuantile(double quantile) const
+    noexcept {
+  if (count_ == 0U) {
+    return 0U;
+  }
+  const double clamped = std::min(std::max(quantile, 0.0), 1.0);
+  const auto rank = std::max<std::uint64_t>(
+      1U, static_cast<std::uint64_t>(
+              std::ceil(clamped * static_cast<double>(count_))));
+
+  std::uint64_t seen = 0U;
+  for (size_t i = 0; i < buckets_.size(); ++i) {
+    seen += buckets_[i];
+    if (seen >= rank) {
+      return std::min(bucketUpperBound(i), max_);
+    }
+  }
+  return max_;
+}
+
+void LatencyHistogram::printSummary(std::string const &title) const {
+  constexpr double kNanosecondsPerMicrosecond = 1000.0;
+  auto micros = [](std::uint64_t nanoseconds) {
+    return static_cast<double>(nanoseconds) / kNanosecondsPerMicrosecond;
+  };
+
+  std::cout << std::fixed << std::setprecision(1);
+  std::cout << "  " << title << " (" << count_ << " samples, μs): "
+            << "p50=" << micros(valueAtQuantile(0.50))
+            << " p90=" << micros(valueAtQuantile(0.90))
+            << " p99=" << micros(valueAtQuantile(0.99))
+            << " p99.9=" << micros(valueAtQuantile(0.999))
+            << " max=" << micros(max()) << "\n";
+}
+
+void FrameLatencyProfile::printReport() const {
+  ingest.printSummary("Ingest  ");
+  sort.printSummary("Sort    ");
+  decision.printSummary("Decision");
+  total.printSummary("Total   ");
+}
+
+void FrameLatencyProfile::merge(FrameLatencyProfile const &other) noexcept {
+  ingest.merge(other.ingest);
+  sort.merge(other.sort);
+  decision.merge(other.decision);
+  total.merge(other.total);
+}
+
+void FrameLatencyProfile::reset() noexcept {
+  ingest.reset();
+  sort.reset();
+  decision.reset();
+  total.reset();
+}
+
+} // namespace object_tracking
+} // namespace aeb
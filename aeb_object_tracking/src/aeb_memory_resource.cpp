@@ -0,0 +1,65 @@
+/// @file aeb_memory_resource.cpp
+
+#include "../include/aeb_memory_resource.h"
+#include <cassert>  // for assert
+#include <new>      // for bad_alloc
+
+namespace aeb {
+namespace object_tracking {
+
+FixedArenaResource::FixedArenaResource(std::size_t capacity_bytes)
+    : owned_{new std::byte[capacity_bytes]}, buffer_{owned_.get()},
+      capacity_{capacity_bytes} {}
+
+FixedArenaResource::FixedArenaResource(void *buffer,
+                                       std::size_t capacity_bytes) noexcept
+    : buffer_{static_cast<std::byte *>(buffer)}, capacity_{capacity_bytes} {}
+
+void *FixedArenaResource::do_allocate(std::size_t bytes,
+                                      std::size_t alignment) {
+  void *pointer = buffer_ + used_;
+  std::size_t space = capacity_ - used_;
+  if (std::align(alignment, bytes, pointer, space) == nullptr) {
+    throw std::bad_alloc();
+  }
+  used_ = capacity_ - space + bytes;
+  return pointer;
+}
+
+void FixedArenaResource::do_deallocate(void * /*pointer*/,
+                                       std::size_t /*bytes*/,
+                                       std::size_t /*alignment*/) {
+  // Monotonic: memory is reclaimed by release() only.
+}
+
+bool FixedArenaResource::do_is_equal(
+    std::pmr::memory_resource const &other) const noexcept {
+  return this == &other;
+}
+
+AllocationGuardResource::AllocationGuardResource(
+    std::pmr::memory_resource *upstream, bool assert_on_violation) noexcept
+    : upstream_{upstream}, assert_on_violation_{assert_on_violation} {}
+
+void *AllocationGuardResource::do_allocate(std::size_t bytes,
+                                           std::size_t alignment) {
+  ++allocations_;
+  if (frozen_) {
+    ++violations_;
+    assert(!assert_on_violation_ && "allocation in the steady-state cycle");
+  }
+  return upstream_->allocate(bytes, alignment);
+}
+
+void AllocationGuardResource::do_deallocate(void *pointer, std::size_t bytes,
+                                            std::size_t alignment) {
+  upstream_->deallocate(pointer, bytes, alignment);
+}
+
+bool AllocationGuardResource::do_is_equal(
+    std::pmr::memory_resource const &other) const noexcept {
+  return this == &other;
+}
+
+} // namespace object_tracking
+} // namespace aeb
@@ -0,0 +1,91 @@
+/// @file aeb_object_id_index.cpp
+
+#include "../include/aeb_object_id_index.h"
+#include <cstdint>  // for uint32_t, uint64_t
+#include <utility>  // for swap
+
+namespace aeb {
+namespace object_tracking {
+
+namespace {
+
+constexpr std::size_t kMinBucketCount = 16U;
+
+/// @brief Smallest power of two with at least twice as many buckets as IDs.
+std::size_t bucketCountFor(std::size_t capacity) noexcept {
+  std::size_t bucket_count = kMinBucketCount;
+  while (bucket_count < capacity * 2U) {
+    bucket_count *= 2U;
+  }
+  return bucket_count;
+}
+
+} // namespace
+
+ObjectIdIndex::ObjectIdIndex(std::pmr::memory_resource *resource)
+    : table_{resource} {}
+
+void ObjectIdIndex::reserve(std::size_t capacity) {
+  const std::size_t bucket_count = bucketCountFor(capacity);
+  if (bucket_count > table_.size()) {
+    rehash(bucket_count);
+  }
+}
+
+void ObjectIdIndex::clear() noexcept {
+  for (auto &entry : table_) {
+    entry.position = kNotFound;
+  }
+  size_ = 0U;
+}
+
+bool ObjectIdIndex::insert(int id, std::size_t position) {
+  reserve(size_ + 1U);
+
+  const std::size_t bucket = probe(id);
+  if (table_[bucket].position != kNotFound) {
+    return false;
+  }
+  table_[bucket] = Entry{id, position};
+  ++size_;
+  return true;
+}
+
+std::size_t ObjectIdIndex::find(int id) const noexcept {
+  if (table_.empty()) {
+    return kNotFound;
+  }
+  return table_[probe(id)].position;
+}
+
+std::size_t ObjectIdIndex::bucketOf(int id) const noexcept {
+  // Fibonacci hashing: sequential IDs spread over the whole table.
+  const std::uint64_t hash =
+      static_cast<std::uint64_t>(static_cast<std::uint32_t>(id)) *
+      0x9E3779B97F4A7C15ULL;
+  return static_cast<std::uint32_t>(hash >> 32U) & mask_;
+}
+
+std::size_t ObjectIdIndex::probe(int id) const noexcept {
+  std::size_t bucket = bucketOf(id);
+  while (table_[bucket].position != kNotFound && table_[bucket].id != id) {
+    bucket = (bucket + 1U) & mask_;
+  }
+  return bucket;
+}
+
+void ObjectIdIndex::rehash(std::size_t bucket_count) {
+  std::pmr::vector<Entry> old_table(bucket_count, Entry{0, kNotFound},
+                                    table_.get_allocator());
+  std::swap(table_, old_table);
+  mask_ = bucket_count - 1U;
+
+  for (auto const &entry : old_table) {
+    if (entry.position != kNotFound) {
+      table_[probe(entry.id)] = entry;
+    }
+  }
+}
+
+} // namespace object_tracking
+} // namespace aeb
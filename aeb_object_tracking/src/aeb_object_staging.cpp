@@ -0,0 +1,61 @@
+/// @file aeb_object_staging.cpp
+
+#include "../include/aeb_object_staging.h"
+#include "../include/aeb_tracker.h"
+#include <algorithm>  // for sort
+
+namespace aeb {
+namespace object_tracking {
+
+ObjectStaging::ObjectStaging(std::size_t producer_count,
+                             std::pmr::memory_resource *resource) {
+  buffers_.reserve(producer_count);
+  for (std::size_t p = 0; p < producer_count; ++p) {
+    buffers_.emplace_back(resource);
+  }
+}
+
+void ObjectStaging::reserve(std::size_t objects_per_producer) {
+  for (auto &buffer : buffers_) {
+    buffer.objects.reserve(objects_per_producer);
+  }
+}
+
+void ObjectStaging::addObject(std::size_t producer,
+                              DetectedObject const &object) {
+  auto &buffer = buffers_[producer];
+  buffer.objects.push_back(object);
+  buffer.sorted = false;
+}
+
+void ObjectStaging::sortRun(std::size_t producer) {
+  auto &buffer = buffers_[producer];
+  if (!buffer.sorted) {
+    std::sort(buffer.objects.begin(), buffer.objects.end(),
+              AEBObjectTracker::Comparators::byCollisionTime);
+    buffer.sorted = true;
+  }
+}
+
+ObjectRange ObjectStaging::getRun(std::size_t producer) const noexcept {
+  auto const &objects = buffers_[producer].objects;
+  return ObjectRange(objects.data(), objects.size());
+}
+
+std::size_t ObjectStaging::stagedCount() const noexcept {
+  std::size_t count = 0U;
+  for (auto const &buffer : buffers_) {
+    count += buffer.objects.size();
+  }
+  return count;
+}
+
+void ObjectStaging::clear() noexcept {
+  for (auto &buffer : buffers_) {
+    buffer.objects.clear();
+    buffer.sorted = true;
+  }
+}
+
+} // namespace object_tracking
+} // namespace aeb
@@ -4,9 +4,11 @@
 #include <bits/chrono.h>  // for duration, duration_cast, operator-, high_re...
 #include <cassert>        // for assert
 #include <iostream>       // for operator<<, basic_ostream, cout, basic_ostr...
-#include <random>         // for uniform_real_distribution, random_device
+#include <random>         // for uniform_real_distribution, mt19937
 #include <string>         // for char_traits, allocator, basic_string
 #include <vector>         // for vector
+#include "aeb_latency_histogram.h"  // for FrameLatencyProfile, AEB_LATEN...
+#include "aeb_scenario_generator.h" // for ScenarioGenerator, ScenarioConfig
 #include "aeb_tracker.h"  // for DetectedObject, AEBObjectTracke
 
 namespace aeb {
@@ -21,6 +23,7 @@ void AEBOutput::runAllTests() {
   testPartialSort();
   testMultiCriteriaSort();
   testPerformance();
+  testFrameLatency();
   testEdgeCases();
   testModernFeatures();
 
@@ -179,24 +182,24 @@ void AEBOutput::testMultiCriteriaSort() {
 void AEBOutput::testPerformance() {
   std::cout << "Test 4: Performance Comparison with Detailed Metrics\n";
 
-  // Initialize random number generation for realistic data
-  std::random_device rd;
-  std::mt19937 gen(rd());
-  std::uniform_real_distribution<float> dist_range(5.0f, 200.0f);
-  std::uniform_real_distribution<float> vel_range(-25.0f, 10.0f);
+  // Mixed traffic scenario with its default fixed seed, so consecutive runs
+  // see the same data. This is a single-shot smoke check; use the
+  // aeb_benchmarks target for comparable numbers.
+  aeb::object_tracking::ScenarioConfig config;
+  config.object_count = kPerformanceTestSize;
+  aeb::object_tracking::ScenarioGenerator generator(config);
+  const aeb::object_tracking::ObjectRange frame = generator.nextFrame();
 
   std::cout << "Generating " << kPerformanceTestSize
-            << " random objects for performance testing...\n";
+            << " objects of mixed traffic for performance testing...\n";
 
   // Test full sort performance with large dataset
   {
     aeb::object_tracking::AEBObjectTracker tracker;
     tracker.reserveCapacity(kPerformanceTestSize);
 
-    // Generate test data
-    for (size_t i = 0; i < kPerformanceTestSize; ++i) {
-      tracker.addObject(aeb::object_tracking::DetectedObject(
-          static_cast<int>(i), dist_range(gen), vel_range(gen)));
+    for (auto const &object : frame) {
+      tracker.addObject(object);
     }
 
     std::cout << "Testing full sort (std::sort)...\n";
@@ -213,9 +216,8 @@ void AEBOutput::testPerformance() {
     aeb::object_tracking::AEBObjectTracker tracker2;
     tracker2.reserveCapacity(kPerformanceTestSize);
 
-    for (size_t i = 0; i < kPerformanceTestSize; ++i) {
-      tracker2.addObject(aeb::object_tracking::DetectedObject(
-          static_cast<int>(i), dist_range(gen), vel_range(gen)));
+    for (auto const &object : frame) {
+      tracker2.addObject(object);
     }
 
     std::cout << "Testing partial sort (top 10 objects)...\n";
@@ -262,10 +264,77 @@ void AEBOutput::testPerformance() {
   std::cout << "✅ Performance test completed with detailed metrics\n\n";
 }
 
+/// @brief Tail latency of the full tracker cycle over many simulated frames
+void AEBOutput::testFrameLatency() {
+  std::cout << "Test 5: Frame Latency Distribution\n";
+
+  if (!kLatencyInstrumentationEnabled) {
+    std::cout << "  Skipped: configure with "
+                 "-DAEB_ENABLE_LATENCY_INSTRUMENTATION=ON\n\n";
+    return;
+  }
+
+  // Pool of objects with a fixed seed; every frame takes a rotating window.
+  constexpr std::mt19937::result_type kSeed = 20240521U;
+  std::mt19937 gen(kSeed);
+  std::uniform_real_distribution<float> dist_range(5.0f, 200.0f);
+  std::uniform_real_distribution<float> vel_range(-25.0f, 10.0f);
+  std::vector<aeb::object_tracking::DetectedObject> pool;
+  pool.reserve(2 * kLatencyTestObjects);
+  for (size_t i = 0; i < 2 * kLatencyTestObjects; ++i) {
+    pool.emplace_back(static_cast<int>(i), dist_range(gen), vel_range(gen));
+  }
+
+  std::cout << "Simulating " << kLatencyTestFrames << " frames of "
+            << kLatencyTestObjects << " objects...\n";
+
+  aeb::object_tracking::AEBObjectTracker tracker;
+  tracker.reserveCapacity(kLatencyTestObjects);
+  aeb::object_tracking::FrameLatencyProfile profile;
+  size_t braking_frames = 0;
+
+  for (size_t frame = 0; frame < kLatencyTestFrames; ++frame) {
+    AEB_LATENCY_SCOPE(profile.total);
+    const size_t offset = frame % kLatencyTestObjects;
+    {
+      AEB_LATENCY_SCOPE(profile.ingest);
+      tracker.clear();
+      for (size_t i = 0; i < kLatencyTestObjects; ++i) {
+        tracker.addObject(pool[offset + i]);
+      }
+    }
+    {
+      AEB_LATENCY_SCOPE(profile.sort);
+      tracker.partialSortCriticalObjects(5);
+    }
+    {
+      AEB_LATENCY_SCOPE(profile.decision);
+      if (tracker.hasCriticalObjects(2.0f)) {
+        ++braking_frames;
+      }
+    }
+  }
+
+  std::cout << "\n📊 Latency per stage:\n";
+  profile.printReport();
+  std::cout << "  Frames with critical objects: " << braking_frames << "\n";
+
+  assert(profile.total.count() == kLatencyTestFrames);
+  const float p999_ms =
+      static_cast<float>(profile.total.valueAtQuantile(0.999)) / 1e6f;
+  if (p999_ms < 10.0f) {
+    std::cout << "  ✅ PASS: p99.9 meets real-time requirement (< 10ms)\n";
+  } else {
+    std::cout << "  ❌ FAIL: p99.9 exceeds real-time requirement (< 10ms)\n";
+  }
+
+  std::cout << "✅ Frame latency test completed\n\n";
+}
+
 /// @brief Test edge cases and boundary conditions with detailed validation
 /// output
 void AEBOutput::testEdgeCases() {
-  std::cout << "Test 5: Edge Cases with Detailed Validation\n";
+  std::cout << "Test 6: Edge Cases with Detailed Validation\n";
 
   aeb::object_tracking::AEBObjectTracker tracker;
 
@@ -316,7 +385,7 @@ void AEBOutput::testEdgeCases() {
 /// @brief Test modern C++ algorithm integration and query functions with result
 /// verification
 void AEBOutput::testModernFeatures() {
-  std::cout << "Test 6: Modern C++ Features with Result Verification\n";
+  std::cout << "Test 7: Modern C++ Features with Result Verification\n";
 
   aeb::object_tracking::AEBObjectTracker tracker;
 
@@ -350,15 +419,15 @@ void AEBOutput::testModernFeatures() {
   std::cout << "\nTesting object search functionality...\n";
 
   // Use explicit type instead of auto
-  std::vector<aeb::object_tracking::DetectedObject>::const_iterator found =
-      tracker.findObjectById(1);
+  aeb::object_tracking::AEBObjectTracker::ObjectContainer::const_iterator
+      found = tracker.findObjectById(1);
   std::cout << "  Search for Object ID 1: ";
   assert(found != tracker.getObjects().end());
   assert(found->getId() == 1);
   std::cout << "✓ Found successfully\n";
 
-  std::vector<aeb::object_tracking::DetectedObject>::const_iterator not_found =
-      tracker.findObjectById(999);
+  aeb::object_tracking::AEBObjectTracker::ObjectContainer::const_iterator
+      not_found = tracker.findObjectById(999);
   std::cout << "  Search for non-existent ID 999: ";
   assert(not_found == tracker.getObjects().end());
   std::cout << "✓ Correctly returns end iterator\n";
@@ -0,0 +1,77 @@
+/// @file aeb_radix_sort.cpp
+
+#include "../include/aeb_radix_sort.h"
+#include <array>    // for array
+#include <numeric>  // for iota
+#include <utility>  // for swap
+
+namespace aeb {
+namespace object_tracking {
+
+namespace {
+
+constexpr std::size_t kRadixBits = 8U; // one byte per pass, see digit()
+constexpr std::size_t kBucketCount = std::size_t{1} << kRadixBits;
+constexpr std::size_t kPassCount = 64U / kRadixBits;
+
+using Histograms =
+    std::array<std::array<std::size_t, kBucketCount>, kPassCount>;
+
+inline std::size_t digit(std::uint64_t key, std::size_t pass) noexcept {
+  return static_cast<std::uint8_t>(key >> (pass * kRadixBits));
+}
+
+} // namespace
+
+RadixKeySorter::RadixKeySorter(std::pmr::memory_resource *resource)
+    : keys_{resource}, key_scratch_{resource}, order_{resource},
+      order_scratch_{resource} {}
+
+void RadixKeySorter::reserve(std::size_t count) {
+  keys_.reserve(count);
+  key_scratch_.reserve(count);
+  order_.reserve(count);
+  order_scratch_.reserve(count);
+}
+
+std::pmr::vector<std::uint32_t> const &
+RadixKeySorter::sort(std::uint64_t const *keys, std::size_t count) {
+  keys_.assign(keys, keys + count);
+  key_scratch_.resize(count);
+  order_.resize(count);
+  order_scratch_.resize(count);
+  std::iota(order_.begin(), order_.end(), std::uint32_t{0});
+
+  Histograms histograms{};
+  for (size_t i = 0; i < count; ++i) {
+    for (size_t pass = 0; pass < kPassCount; ++pass) {
+      ++histograms[pass][digit(keys_[i], pass)];
+    }
+  }
+
+  for (size_t pass = 0; pass < kPassCount; ++pass) {
+    auto &histogram = histograms[pass];
+    // Every key has the same digit: this pass would not move anything.
+    if (count == 0U || histogram[digit(keys_[0], pass)] == count) {
+      continue;
+    }
+
+    size_t offset = 0;
+    for (auto &bucket : histogram) {
+      const size_t bucket_size = bucket;
+      bucket = offset;
+      offset += bucket_size;
+    }
+    for (size_t i = 0; i < count; ++i) {
+      const size_t target = histogram[digit(keys_[i], pass)]++;
+      key_scratch_[target] = keys_[i];
+      order_scratch_[target] = order_[i];
+    }
+    std::swap(keys_, key_scratch_);
+    std::swap(order_, order_scratch_);
+  }
+  return order_;
+}
+
+} // namespace object_tracking
+} // namespace aeb
@@ -0,0 +1,131 @@
+/// @file aeb_scenario_generator.cpp
+
+#include "../include/aeb_scenario_generator.h"
+#include <algorithm>  // for clamp
+
+namespace aeb {
+namespace object_tracking {
+
+namespace {
+
+/// Spawn and motion envelope of a track kind.
+struct KindProfile {
+  float min_distance;   ///< m
+  float max_distance;   ///< m; beyond this the track is dropped
+  float min_velocity;   ///< m/s
+  float max_velocity;   ///< m/s
+  float velocity_drift; ///< max velocity change per frame, m/s
+};
+
+/// Tracks closer than this have been passed and are dropped.
+constexpr float kPassedDistance = 0.5f;
+
+/// Indexed by ScenarioGenerator::TrackKind.
+constexpr KindProfile kProfiles[] = {
+    {10.0f, 250.0f, -6.0f, 3.0f, 0.1f},  // kVehicle
+    {3.0f, 60.0f, -12.0f, -4.0f, 0.2f},  // kPedestrian
+    {6.0f, 25.0f, -8.0f, -2.0f, 0.3f},   // kCutInVehicle
+    {5.0f, 200.0f, 0.0f, 0.5f, 0.0f},    // kStationary (never approaches)
+};
+
+} // namespace
+
+char const *toString(ScenarioType type) noexcept {
+  switch (type) {
+  case ScenarioType::kHighwayPlatoon:
+    return "highway";
+  case ScenarioType::kUrbanClutter:
+    return "urban";
+  case ScenarioType::kCutIn:
+    return "cut-in";
+  case ScenarioType::kStationaryClutter:
+    return "stationary";
+  case ScenarioType::kMixed:
+    return "mixed";
+  }
+  return "unknown";
+}
+
+ScenarioGenerator::ScenarioGenerator(ScenarioConfig const &config)
+    : config_{config}, gen_{config.seed} {
+  tracks_.reserve(config_.object_count);
+  frame_.reserve(config_.object_count);
+  for (std::size_t i = 0; i < config_.object_count; ++i) {
+    tracks_.push_back(spawn(kindFor(i)));
+  }
+}
+
+ObjectRange ScenarioGenerator::nextFrame() {
+  frame_.clear();
+  for (auto &track : tracks_) {
+    if (frame_count_ > 0U) {
+      advance(track);
+    }
+    frame_.emplace_back(track.id, track.distance, track.relative_velocity);
+  }
+  ++frame_count_;
+  return ObjectRange(frame_.data(), frame_.size());
+}
+
+float ScenarioGenerator::uniform(float low, float high) {
+  // 24 random bits fill the float mantissa exactly.
+  constexpr float kScale = 1.0f / 16777216.0f;
+  const auto bits = static_cast<std::uint32_t>(gen_() >> 8U);
+  return low + (high - low) * static_cast<float>(bits) * kScale;
+}
+
+ScenarioGenerator::TrackKind
+ScenarioGenerator::kindFor(std::size_t track_index) const noexcept {
+  switch (config_.type) {
+  case ScenarioType::kHighwayPlatoon:
+    return TrackKind::kVehicle;
+  case ScenarioType::kUrbanClutter:
+    return track_index % 10U < 8U ? TrackKind::kPedestrian
+                                  : TrackKind::kVehicle;
+  case ScenarioType::kCutIn:
+    return track_index % 50U == 0U ? TrackKind::kCutInVehicle
+                                   : TrackKind::kVehicle;
+  case ScenarioType::kStationaryClutter:
+    return TrackKind::kStationary;
+  case ScenarioType::kMixed:
+    break;
+  }
+  // Mixed: 40% vehicles, 30% pedestrians, 25% stationary, 5% cut-ins.
+  const std::size_t slot = track_index % 20U;
+  if (slot < 8U) {
+    return TrackKind::kVehicle;
+  }
+  if (slot < 14U) {
+    return TrackKind::kPedestrian;
+  }
+  if (slot < 19U) {
+    return TrackKind::kStationary;
+  }
+  return TrackKind::kCutInVehicle;
+}
+
+ScenarioGenerator::Track ScenarioGenerator::spawn(TrackKind kind) {
+  KindProfile const &profile = kProfiles[static_cast<std::size_t>(kind)];
+  const float distance = uniform(profile.min_distance, profile.max_distance);
+  const float velocity = uniform(profile.min_velocity, profile.max_velocity);
+  return Track{next_id_++, distance, velocity, kind};
+}
+
+void ScenarioGenerator::advance(Track &track) {
+  KindProfile const &profile = kProfiles[static_cast<std::size_t>(track.kind)];
+  track.distance += track.relative_velocity * config_.frame_period_s;
+  if (track.distance < kPassedDistance ||
+      track.distance > profile.max_distance) {
+    track = spawn(track.kind);
+    return;
+  }
+  if (profile.velocity_drift > 0.0f) {
+    track.relative_velocity = std::clamp(
+        track.relative_velocity +
+            uniform(-profile.velocity_drift, profile.velocity_drift),
+        profile.min_velocity, profile.max_velocity);
+  }
+}
+
+} // namespace object_tracking
+} // namespace aeb
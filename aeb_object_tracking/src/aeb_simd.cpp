@@ -0,0 +1,526 @@
+/// @file aeb_simd.cpp
+
+#include "../include/aeb_simd.h"
+#include "../include/aeb_collision_model.h"
+#include <limits>  // for numeric_limits
+
+#if defined(__AVX2__)
+#define AEB_SIMD_AVX2 1
+#include <immintrin.h>  // for __m256, _mm256_*
+#elif defined(__SSE2__) || defined(_M_X64)
+#define AEB_SIMD_SSE2 1
+#include <emmintrin.h>  // for __m128, _mm_*
+#endif
+
+namespace aeb {
+namespace object_tracking {
+namespace simd {
+
+namespace {
+
+#if defined(AEB_SIMD_AVX2)
+
+constexpr std::size_t kLanes = 8U;
+
+/// @brief Threat level between the imminent and irrelevant TTC bands.
+inline __m256 threatLevels(__m256 distance, __m256 collision_time) noexcept {
+  const __m256 zero = _mm256_setzero_ps();
+  const __m256 one = _mm256_set1_ps(1.0f);
+  const __m256 half = _mm256_set1_ps(0.5f);
+  const __m256 imminent_time = _mm256_set1_ps(kImminentCollisionTime);
+  const __m256 irrelevant_time = _mm256_set1_ps(kIrrelevantCollisionTime);
+  const __m256 distance_range = _mm256_set1_ps(kThreatDistanceRange);
+
+  const __m256 distance_factor = _mm256_max_ps(
+      _mm256_sub_ps(one, _mm256_div_ps(distance, distance_range)), zero);
+  const __m256 time_factor = _mm256_max_ps(
+      _mm256_sub_ps(one, _mm256_div_ps(collision_time, irrelevant_time)),
+      zero);
+  const __m256 blended =
+      _mm256_mul_ps(_mm256_add_ps(distance_factor, time_factor), half);
+
+  // Saturate outside the bands (> 10s -> 0.0, < 1s -> 1.0).
+  const __m256 imminent =
+      _mm256_cmp_ps(collision_time, imminent_time, _CMP_LT_OQ);
+  const __m256 irrelevant =
+      _mm256_cmp_ps(collision_time, irrelevant_time, _CMP_GT_OQ);
+  return _mm256_blendv_ps(_mm256_blendv_ps(blended, one, imminent), zero,
+                          irrelevant);
+}
+
+/// @brief Process one block of kLanes objects.
+inline void collisionTimesBlock(float const *distances,
+                                float const *relative_velocities,
+                                float *collision_times,
+                                float *threat_levels) noexcept {
+  const __m256 sign_mask = _mm256_set1_ps(-0.0f);
+  const __m256 infinity =
+      _mm256_set1_ps(std::numeric_limits<float>::infinity());
+  const __m256 approaching_velocity =
+      _mm256_set1_ps(kApproachingVelocityThreshold);
+
+  const __m256 distance = _mm256_loadu_ps(distances);
+  const __m256 velocity = _mm256_loadu_ps(relative_velocities);
+
+  // TTC = distance / -velocity for approaching objects, infinity otherwise.
+  const __m256 approaching =
+      _mm256_cmp_ps(velocity, approaching_velocity, _CMP_LT_OQ);
+  const __m256 raw_time =
+      _mm256_div_ps(distance, _mm256_xor_ps(velocity, sign_mask));
+  const __m256 collision_time =
+      _mm256_blendv_ps(infinity, raw_time, approaching);
+
+  _mm256_storeu_ps(collision_times, collision_time);
+  _mm256_storeu_ps(threat_levels, threatLevels(distance, collision_time));
+}
+
+/// @brief TTC = 2 d / (sqrt(v^2 - 2 a d) - v) where the object closes in,
+/// infinity otherwise.
+inline __m256 accelerationCollisionTimes(__m256 distance, __m256 velocity,
+                                         __m256 acceleration) noexcept {
+  const __m256 zero = _mm256_setzero_ps();
+  const __m256 infinity =
+      _mm256_set1_ps(std::numeric_limits<float>::infinity());
+  const __m256 closing_threshold = _mm256_set1_ps(kApproachingClosingTerm);
+
+  const __m256 discriminant =
+      _mm256_sub_ps(_mm256_mul_ps(velocity, velocity),
+                    _mm256_mul_ps(_mm256_add_ps(acceleration, acceleration),
+                                  distance));
+  const __m256 closing_term = _mm256_sub_ps(
+      _mm256_sqrt_ps(_mm256_max_ps(discriminant, zero)), velocity);
+  const __m256 approaching = _mm256_and_ps(
+      _mm256_cmp_ps(discriminant, zero, _CMP_GE_OQ),
+      _mm256_cmp_ps(closing_term, closing_threshold, _CMP_GT_OQ));
+  const __m256 raw_time =
+      _mm256_div_ps(_mm256_add_ps(distance, distance), closing_term);
+  return _mm256_blendv_ps(infinity, raw_time, approaching);
+}
+
+/// @brief Constant-acceleration, ego-compensated variant of
+/// collisionTimesBlock().
+inline void collisionTimesBlock(float const *distances,
+                                float const *velocities,
+                                float const *accelerations,
+                                EgoMotion const &ego,
+                                float *relative_velocities,
+                                float *collision_times,
+                                float *threat_levels) noexcept {
+  const __m256 distance = _mm256_loadu_ps(distances);
+  const __m256 velocity =
+      _mm256_sub_ps(_mm256_loadu_ps(velocities), _mm256_set1_ps(ego.speed));
+  const __m256 acceleration = _mm256_sub_ps(
+      _mm256_loadu_ps(accelerations), _mm256_set1_ps(ego.acceleration));
+  const __m256 collision_time =
+      accelerationCollisionTimes(distance, velocity, acceleration);
+
+  _mm256_storeu_ps(relative_velocities, velocity);
+  _mm256_storeu_ps(collision_times, collision_time);
+  _mm256_storeu_ps(threat_levels, threatLevels(distance, collision_time));
+}
+
+/// @brief Extrapolate one block of kLanes objects by step_time.
+inline void projectBlock(float const *distances,
+                         float const *relative_velocities,
+                         float const *relative_accelerations,
+                         float const *collision_times, float step_time,
+                         float *projected_distances,
+                         float *projected_velocities,
+                         float *projected_collision_times,
+                         float *projected_threat_levels) noexcept {
+  const __m256 zero = _mm256_setzero_ps();
+  const __m256 time = _mm256_set1_ps(step_time);
+  const __m256 half_time_squared =
+      _mm256_set1_ps(0.5f * step_time * step_time);
+
+  const __m256 velocity = _mm256_loadu_ps(relative_velocities);
+  const __m256 acceleration = _mm256_loadu_ps(relative_accelerations);
+  const __m256 reached =
+      _mm256_cmp_ps(_mm256_loadu_ps(collision_times), time, _CMP_LE_OQ);
+  const __m256 moved = _mm256_add_ps(
+      _mm256_add_ps(_mm256_loadu_ps(distances),
+                    _mm256_mul_ps(velocity, time)),
+      _mm256_mul_ps(acceleration, half_time_squared));
+  const __m256 distance = _mm256_blendv_ps(moved, zero, reached);
+  const __m256 projected_velocity =
+      _mm256_add_ps(velocity, _mm256_mul_ps(acceleration, time));
+  const __m256 collision_time = _mm256_blendv_ps(
+      accelerationCollisionTimes(distance, projected_velocity, acceleration),
+      zero, reached);
+
+  _mm256_storeu_ps(projected_distances, distance);
+  _mm256_storeu_ps(projected_velocities, projected_velocity);
+  _mm256_storeu_ps(projected_collision_times, collision_time);
+  _mm256_storeu_ps(projected_threat_levels,
+                   threatLevels(distance, collision_time));
+}
+
+using Vec = __m256;
+
+inline Vec broadcast(float value) noexcept { return _mm256_set1_ps(value); }
+
+inline Vec maskOr(Vec first, Vec second) noexcept {
+  return _mm256_or_ps(first, second);
+}
+
+inline unsigned maskBits(Vec mask) noexcept {
+  return static_cast<unsigned>(_mm256_movemask_ps(mask));
+}
+
+/// @brief Lane mask of finite collision times <= threshold.
+inline Vec withinThresholdMask(float const *collision_times,
+                               Vec threshold) noexcept {
+  const Vec sign_mask = _mm256_set1_ps(-0.0f);
+  const Vec infinity = _mm256_set1_ps(std::numeric_limits<float>::infinity());
+
+  const Vec collision_time = _mm256_loadu_ps(collision_times);
+  const Vec finite = _mm256_cmp_ps(_mm256_andnot_ps(sign_mask, collision_time),
+                                   infinity, _CMP_LT_OQ);
+  const Vec within = _mm256_cmp_ps(collision_time, threshold, _CMP_LE_OQ);
+  return _mm256_and_ps(finite, within);
+}
+
+#elif defined(AEB_SIMD_SSE2)
+
+constexpr std::size_t kLanes = 4U;
+
+/// @brief Branchless lane select: mask ? if_true : if_false.
+inline __m128 select(__m128 mask, __m128 if_true, __m128 if_false) noexcept {
+  return _mm_or_ps(_mm_and_ps(mask, if_true), _mm_andnot_ps(mask, if_false));
+}
+
+/// @brief Threat level between the imminent and irrelevant TTC bands.
+inline __m128 threatLevels(__m128 distance, __m128 collision_time) noexcept {
+  const __m128 zero = _mm_setzero_ps();
+  const __m128 one = _mm_set1_ps(1.0f);
+  const __m128 half = _mm_set1_ps(0.5f);
+  const __m128 imminent_time = _mm_set1_ps(kImminentCollisionTime);
+  const __m128 irrelevant_time = _mm_set1_ps(kIrrelevantCollisionTime);
+  const __m128 distance_range = _mm_set1_ps(kThreatDistanceRange);
+
+  const __m128 distance_factor =
+      _mm_max_ps(_mm_sub_ps(one, _mm_div_ps(distance, distance_range)), zero);
+  const __m128 time_factor = _mm_max_ps(
+      _mm_sub_ps(one, _mm_div_ps(collision_time, irrelevant_time)), zero);
+  const __m128 blended = _mm_mul_ps(_mm_add_ps(distance_factor, time_factor),
+                                    half);
+
+  // Saturate outside the bands (> 10s -> 0.0, < 1s -> 1.0).
+  const __m128 imminent = _mm_cmplt_ps(collision_time, imminent_time);
+  const __m128 irrelevant = _mm_cmpgt_ps(collision_time, irrelevant_time);
+  return select(irrelevant, zero, select(imminent, one, blended));
+}
+
+/// @brief Process one block of kLanes objects.
+inline void collisionTimesBlock(float const *distances,
+                                float const *relative_velocities,
+                                float *collision_times,
+                                float *threat_levels) noexcept {
+  const __m128 sign_mask = _mm_set1_ps(-0.0f);
+  const __m128 infinity = _mm_set1_ps(std::numeric_limits<float>::infinity());
+  const __m128 approaching_velocity =
+      _mm_set1_ps(kApproachingVelocityThreshold);
+
+  const __m128 distance = _mm_loadu_ps(distances);
+  const __m128 velocity = _mm_loadu_ps(relative_velocities);
+
+  // TTC = distance / -velocity for approaching objects, infinity otherwise.
+  const __m128 approaching = _mm_cmplt_ps(velocity, approaching_velocity);
+  const __m128 raw_time = _mm_div_ps(distance, _mm_xor_ps(velocity, sign_mask));
+  const __m128 collision_time = select(approaching, raw_time, infinity);
+
+  _mm_storeu_ps(collision_times, collision_time);
+  _mm_storeu_ps(threat_levels, threatLevels(distance, collision_time));
+}
+
+/// @brief TTC = 2 d / (sqrt(v^2 - 2 a d) - v) where the object closes in,
+/// infinity otherwise.
+inline __m128 accelerationCollisionTimes(__m128 distance, __m128 velocity,
+                                         __m128 acceleration) noexcept {
+  const __m128 zero = _mm_setzero_ps();
+  const __m128 infinity = _mm_set1_ps(std::numeric_limits<float>::infinity());
+  const __m128 closing_threshold = _mm_set1_ps(kApproachingClosingTerm);
+
+  const __m128 discriminant = _mm_sub_ps(
+      _mm_mul_ps(velocity, velocity),
+      _mm_mul_ps(_mm_add_ps(acceleration, acceleration), distance));
+  const __m128 closing_term =
+      _mm_sub_ps(_mm_sqrt_ps(_mm_max_ps(discriminant, zero)), velocity);
+  const __m128 approaching =
+      _mm_and_ps(_mm_cmpge_ps(discriminant, zero),
+                 _mm_cmpgt_ps(closing_term, closing_threshold));
+  const __m128 raw_time =
+      _mm_div_ps(_mm_add_ps(distance, distance), closing_term);
+  return select(approaching, raw_time, infinity);
+}
+
+/// @brief Constant-acceleration, ego-compensated variant of
+/// collisionTimesBlock().
+inline void collisionTimesBlock(float const *distances,
+                                float const *velocities,
+                                float const *accelerations,
+                                EgoMotion const &ego,
+                                float *relative_velocities,
+                                float *collision_times,
+                                float *threat_levels) noexcept {
+  const __m128 distance = _mm_loadu_ps(distances);
+  const __m128 velocity =
+      _mm_sub_ps(_mm_loadu_ps(velocities), _mm_set1_ps(ego.speed));
+  const __m128 acceleration =
+      _mm_sub_ps(_mm_loadu_ps(accelerations), _mm_set1_ps(ego.acceleration));
+  const __m128 collision_time =
+      accelerationCollisionTimes(distance, velocity, acceleration);
+
+  _mm_storeu_ps(relative_velocities, velocity);
+  _mm_storeu_ps(collision_times, collision_time);
+  _mm_storeu_ps(threat_levels, threatLevels(distance, collision_time));
+}
+
+/// @brief Extrapolate one block of kLanes objects by step_time.
+inline void projectBlock(float const *distances,
+                         float const *relative_velocities,
+                         float const *relative_accelerations,
+                         float const *collision_times, float step_time,
+                         float *projected_distances,
+                         float *projected_velocities,
+                         float *projected_collision_times,
+                         float *projected_threat_levels) noexcept {
+  const __m128 zero = _mm_setzero_ps();
+  const __m128 time = _mm_set1_ps(step_time);
+  const __m128 half_time_squared = _mm_set1_ps(0.5f * step_time * step_time);
+
+  const __m128 velocity = _mm_loadu_ps(relative_velocities);
+  const __m128 acceleration = _mm_loadu_ps(relative_accelerations);
+  const __m128 reached = _mm_cmple_ps(_mm_loadu_ps(collision_times), time);
+  const __m128 moved = _mm_add_ps(
+      _mm_add_ps(_mm_loadu_ps(distances), _mm_mul_ps(velocity, time)),
+      _mm_mul_ps(acceleration, half_time_squared));
+  const __m128 distance = select(reached, zero, moved);
+  const __m128 projected_velocity =
+      _mm_add_ps(velocity, _mm_mul_ps(acceleration, time));
+  const __m128 collision_time = select(
+      reached, zero,
+      accelerationCollisionTimes(distance, projected_velocity, acceleration));
+
+  _mm_storeu_ps(projected_distances, distance);
+  _mm_storeu_ps(projected_velocities, projected_velocity);
+  _mm_storeu_ps(projected_collision_times, collision_time);
+  _mm_storeu_ps(projected_threat_levels,
+                threatLevels(distance, collision_time));
+}
+
+using Vec = __m128;
+
+inline Vec broadcast(float value) noexcept { return _mm_set1_ps(value); }
+
+inline Vec maskOr(Vec first, Vec second) noexcept {
+  return _mm_or_ps(first, second);
+}
+
+inline unsigned maskBits(Vec mask) noexcept {
+  return static_cast<unsigned>(_mm_movemask_ps(mask));
+}
+
+/// @brief Lane mask of finite collision times <= threshold.
+inline Vec withinThresholdMask(float const *collision_times,
+                               Vec threshold) noexcept {
+  const Vec sign_mask = _mm_set1_ps(-0.0f);
+  const Vec infinity = _mm_set1_ps(std::numeric_limits<float>::infinity());
+
+  const Vec collision_time = _mm_loadu_ps(collision_times);
+  const Vec finite =
+      _mm_cmplt_ps(_mm_andnot_ps(sign_mask, collision_time), infinity);
+  const Vec within = _mm_cmple_ps(collision_time, threshold);
+  return _mm_and_ps(finite, within);
+}
+
+#endif
+
+} // namespace
+
+char const *activeInstructionSet() noexcept {
+#if defined(AEB_SIMD_AVX2)
+  return "AVX2";
+#elif defined(AEB_SIMD_SSE2)
+  return "SSE2";
+#else
+  return "scalar";
+#endif
+}
+
+void computeCollisionTimesScalar(float const *distances,
+                                 float const *relative_velocities,
+                                 float *collision_times, float *threat_levels,
+                                 std::size_t count) noexcept {
+  for (std::size_t i = 0; i < count; ++i) {
+    collision_times[i] =
+        computeCollisionTime(distances[i], relative_velocities[i]);
+    threat_levels[i] = computeThreatLevel(distances[i], collision_times[i]);
+  }
+}
+
+void computeCollisionTimes(float const *distances,
+                           float const *relative_velocities,
+                           float *collision_times, float *threat_levels,
+                           std::size_t count) noexcept {
+  std::size_t i = 0;
+#if defined(AEB_SIMD_AVX2) || defined(AEB_SIMD_SSE2)
+  for (; i + kLanes <= count; i += kLanes) {
+    collisionTimesBlock(distances + i, relative_velocities + i,
+                        collision_times + i, threat_levels + i);
+  }
+#endif
+  computeCollisionTimesScalar(distances + i, relative_velocities + i,
+                              collision_times + i, threat_levels + i,
+                              count - i);
+}
+
+void computeCollisionTimesScalar(float const *distances,
+                                 float const *velocities,
+                                 float const *accelerations,
+                                 EgoMotion const &ego,
+                                 float *relative_velocities,
+                                 float *collision_times, float *threat_levels,
+                                 std::size_t count) noexcept {
+  for (std::size_t i = 0; i < count; ++i) {
+    const float relative_velocity = velocities[i] - ego.speed;
+    collision_times[i] = computeCollisionTime(
+        distances[i], relative_velocity, accelerations[i] - ego.acceleration);
+    threat_levels[i] = computeThreatLevel(distances[i], collision_times[i]);
+    relative_velocities[i] = relative_velocity;
+  }
+}
+
+void computeCollisionTimes(float const *distances, float const *velocities,
+                           float const *accelerations, EgoMotion const &ego,
+                           float *relative_velocities, float *collision_times,
+                           float *threat_levels, std::size_t count) noexcept {
+  std::size_t i = 0;
+#if defined(AEB_SIMD_AVX2) || defined(AEB_SIMD_SSE2)
+  for (; i + kLanes <= count; i += kLanes) {
+    collisionTimesBlock(distances + i, velocities + i, accelerations + i, ego,
+                        relative_velocities + i, collision_times + i,
+                        threat_levels + i);
+  }
+#endif
+  computeCollisionTimesScalar(distances + i, velocities + i,
+                              accelerations + i, ego, relative_velocities + i,
+                              collision_times + i, threat_levels + i,
+                              count - i);
+}
+
+void projectCollisionTimesScalar(
+    float const *distances, float const *relative_velocities,
+    float const *relative_accelerations, float const *collision_times,
+    std::size_t count, float step_time, float *projected_distances,
+    float *projected_velocities, float *projected_collision_times,
+    float *projected_threat_levels) noexcept {
+  const float half_time_squared = 0.5f * step_time * step_time;
+  for (std::size_t i = 0; i < count; ++i) {
+    const float acceleration = relative_accelerations[i];
+    const bool reached = collision_times[i] <= step_time;
+    const float distance =
+        reached ? 0.0f
+                : distances[i] + relative_velocities[i] * step_time +
+                      acceleration * half_time_squared;
+    const float velocity = relative_velocities[i] + acceleration * step_time;
+    const float collision_time =
+        reached ? 0.0f
+                : computeCollisionTime(distance, velocity, acceleration);
+    projected_distances[i] = distance;
+    projected_velocities[i] = velocity;
+    projected_collision_times[i] = collision_time;
+    projected_threat_levels[i] = computeThreatLevel(distance, collision_time);
+  }
+}
+
+void projectCollisionTimes(float const *distances,
+                           float const *relative_velocities,
+                           float const *relative_accelerations,
+                           float const *collision_times, std::size_t count,
+                           float step_time, float *projected_distances,
+                           float *projected_velocities,
+                           float *projected_collision_times,
+                           float *projected_threat_levels) noexcept {
+  std::size_t i = 0;
+#if defined(AEB_SIMD_AVX2) || defined(AEB_SIMD_SSE2)
+  for (; i + kLanes <= count; i += kLanes) {
+    projectBlock(distances + i, relative_velocities + i,
+                 relative_accelerations + i, collision_times + i, step_time,
+                 projected_distances + i, projected_velocities + i,
+                 projected_collision_times + i, projected_threat_levels + i);
+  }
+#endif
+  projectCollisionTimesScalar(
+      distances + i, relative_velocities + i, relative_accelerations + i,
+      collision_times + i, count - i, step_time, projected_distances + i,
+      projected_velocities + i, projected_collision_times + i,
+      projected_threat_levels + i);
+}
+
+bool anyWithinThreshold(float const *collision_times, std::size_t count,
+                        float threshold_seconds) noexcept {
+  std::size_t i = 0;
+#if defined(AEB_SIMD_AVX2) || defined(AEB_SIMD_SSE2)
+  constexpr std::size_t kBlock = 4U * kLanes;
+  const Vec threshold = broadcast(threshold_seconds);
+
+  for (; i + kBlock <= count; i += kBlock) {
+    const Vec block_mask = maskOr(
+        maskOr(withinThresholdMask(collision_times + i, threshold),
+               withinThresholdMask(collision_times + i + kLanes, threshold)),
+        maskOr(withinThresholdMask(collision_times + i + 2U * kLanes,
+                                   threshold),
+               withinThresholdMask(collision_times + i + 3U * kLanes,
+                                   threshold)));
+    if (maskBits(block_mask) != 0U) {
+      return true;
+    }
+  }
+  for (; i + kLanes <= count; i += kLanes) {
+    if (maskBits(withinThresholdMask(collision_times + i, threshold)) != 0U) {
+      return true;
+    }
+  }
+#endif
+  for (; i < count; ++i) {
+    if (isWithinCollisionTimeThreshold(collision_times[i],
+                                       threshold_seconds)) {
+      return true;
+    }
+  }
+  return false;
+}
+
+std::size_t filterWithinThreshold(float const *collision_times,
+                                  std::size_t count, float threshold_seconds,
+                                  std::size_t *indices) noexcept {
+  // Every candidate index is stored unconditionally and the write cursor only
+  // advances for matches, so the loop has no data-dependent branches.
+  std::size_t written = 0;
+  std::size_t i = 0;
+#if defined(AEB_SIMD_AVX2) || defined(AEB_SIMD_SSE2)
+  const Vec threshold = broadcast(threshold_seconds);
+
+  for (; i + kLanes <= count; i += kLanes) {
+    const unsigned bits =
+        maskBits(withinThresholdMask(collision_times + i, threshold));
+    for (std::size_t lane = 0; lane < kLanes; ++lane) {
+      indices[written] = i + lane;
+      written += (bits >> lane) & 1U;
+    }
+  }
+#endif
+  for (; i < count; ++i) {
+    indices[written] = i;
+    written +=
+        isWithinCollisionTimeThreshold(collision_times[i], threshold_seconds)
+            ? 1U
+            : 0U;
+  }
+  return written;
+}
+
+} // namespace simd
+} // namespace object_tracking
+} // namespace aeb
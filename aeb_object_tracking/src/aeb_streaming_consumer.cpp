@@ -0,0 +1,79 @@
+/// @file aeb_streaming_consumer.cpp
+
+#include "../include/aeb_streaming_consumer.h"
+#include "../include/aeb_simd.h"
+#include <algorithm>  // for min
+#include <cmath>      // for isinf
+
+namespace aeb {
+namespace object_tracking {
+
+StreamingObjectConsumer::StreamingObjectConsumer(
+    std::size_t max_objects, std::vector<float> const &band_thresholds,
+    std::pmr::memory_resource *resource)
+    : band_thresholds_{band_thresholds}, critical_set_{max_objects, resource} {
+  beginScan();
+}
+
+void StreamingObjectConsumer::beginScan() {
+  bands_.reset(band_thresholds_, false);
+  critical_set_.clear();
+  consumed_ = 0U;
+}
+
+void StreamingObjectConsumer::consume(DetectedObject const &object) {
+  bands_.record(consumed_++, object.getCollisionTime());
+  if (mayBeCritical(object.getCollisionTime())) {
+    critical_set_.offer(object);
+  }
+}
+
+void StreamingObjectConsumer::consume(ObjectRange objects) {
+  for (auto const &object : objects) {
+    consume(object);
+  }
+}
+
+void StreamingObjectConsumer::consume(int const *ids, float const *distances,
+                                      float const *relative_velocities,
+                                      std::size_t count) {
+  for (std::size_t begin = 0U; begin < count; begin += kChunkSize) {
+    const std::size_t chunk = std::min(kChunkSize, count - begin);
+    simd::computeCollisionTimes(distances + begin, relative_velocities + begin,
+                                chunk_collision_times_.data(),
+                                chunk_threat_levels_.data(), chunk);
+    for (std::size_t i = 0U; i < chunk; ++i) {
+      const float collision_time = chunk_collision_times_[i];
+      bands_.record(consumed_++, collision_time);
+      if (mayBeCritical(collision_time)) {
+        critical_set_.offer(DetectedObject(ids[begin + i], distances[begin + i],
+                                           relative_velocities[begin + i]));
+      }
+    }
+  }
+}
+
+std::size_t StreamingObjectConsumer::beyondBandsCount() const {
+  if (bands_.bandCount() == 0U) {
+    return consumed_;
+  }
+  return consumed_ - bands_.countWithin(bands_.bandCount() - 1U);
+}
+
+bool StreamingObjectConsumer::mayBeCritical(
+    float collision_time) const noexcept {
+  if (critical_set_.capacity() == 0U) {
+    return false;
+  }
+  if (!critical_set_.full()) {
+    return true;
+  }
+  // Objects with infinite TTC are ordered by distance; let offer() decide.
+  const float least_critical_time =
+      critical_set_.objects()[critical_set_.size() - 1U].getCollisionTime();
+  return std::isinf(least_critical_time) ||
+         collision_time < least_critical_time;
+}
+
+} // namespace object_tracking
+} // namespace aeb
@@ -0,0 +1,64 @@
+/// @file aeb_threshold_classification.cpp
+
+#include "../include/aeb_threshold_classification.h"
+#include <algorithm>  // for lower_bound, is_sorted, min
+#include <cassert>    // for assert
+#include <cmath>      // for isinf
+#include <iterator>   // for distance
+
+namespace aeb {
+namespace object_tracking {
+
+void ThresholdClassification::reset(std::vector<float> const &thresholds,
+                                    bool collect_indices) {
+  assert(std::is_sorted(thresholds.begin(), thresholds.end()));
+
+  thresholds_.assign(thresholds.begin(), thresholds.end());
+  band_counts_.assign(thresholds.size(), 0U);
+  first_indices_.assign(thresholds.size(), kNoMatch);
+  band_indices_.resize(thresholds.size());
+  for (auto &band : band_indices_) {
+    band.clear();
+  }
+  collect_indices_ = collect_indices;
+}
+
+void ThresholdClassification::record(std::size_t index, float collision_time) {
+  // Also rejects NaN and every TTC beyond the last band.
+  if (thresholds_.empty() || std::isinf(collision_time) ||
+      !(collision_time <= thresholds_.back())) {
+    return;
+  }
+
+  const auto band = static_cast<std::size_t>(std::distance(
+      thresholds_.begin(),
+      std::lower_bound(thresholds_.begin(), thresholds_.end(),
+                       collision_time)));
+
+  ++band_counts_[band];
+  if (first_indices_[band] == kNoMatch) {
+    first_indices_[band] = index;
+  }
+  if (collect_indices_) {
+    band_indices_[band].push_back(index);
+  }
+}
+
+std::size_t ThresholdClassification::countWithin(std::size_t band) const {
+  std::size_t total = 0;
+  for (std::size_t i = 0; i <= band; ++i) {
+    total += band_counts_[i];
+  }
+  return total;
+}
+
+std::size_t ThresholdClassification::firstWithin(std::size_t band) const {
+  std::size_t first = kNoMatch;
+  for (std::size_t i = 0; i <= band; ++i) {
+    first = std::min(first, first_indices_[i]);
+  }
+  return first;
+}
+
+} // namespace object_tracking
+} // namespace aeb
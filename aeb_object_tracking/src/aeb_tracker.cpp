@@ -1,7 +1,11 @@
 /// @file aeb_tracker.cpp
 
 #include "../include/aeb_tracker.h"
+#include "../include/aeb_collision_model.h"
+#include "../include/aeb_frame_log.h"
+#include "../include/aeb_simd.h"
 #include <algorithm>  // for sort, max, min, any_of, copy_if, find_if, parti...
+#include <array>      // for array
 #include <iomanip>    // for operator<<, setprecision
 #include <iostream>   // for basic_ostream, operator<<, cout, basic_ios, bas...
 #include <iterator>   // for back_insert_iterator, back_inserter
@@ -10,7 +14,30 @@
 namespace aeb {
 namespace object_tracking {
 
-DetectedObject::DetectedObject() noexcept : DetectedObject(0, 0.0f, 0.0f) {}
+namespace {
+
+// The parallel sorts need strict weak orders: with the non-transitive
+// epsilon comparators, a chunked sort depends on where the chunks split.
+
+bool byThreatLevelSortKey(DetectedObject const &first_object,
+                          DetectedObject const &second_object) noexcept {
+  return threatLevelSortKey(first_object.getThreatLevel(),
+                            first_object.getDistance()) <
+         threatLevelSortKey(second_object.getThreatLevel(),
+                            second_object.getDistance());
+}
+
+bool byMultiCriteriaSortKey(DetectedObject const &first_object,
+                            DetectedObject const &second_object) noexcept {
+  return multiCriteriaSortKey(first_object.getThreatLevel(),
+                              first_object.getCollisionTime(),
+                              first_object.getDistance()) <
+         multiCriteriaSortKey(second_object.getThreatLevel(),
+                              second_object.getCollisionTime(),
+                              second_object.getDistance());
+}
+
+} // namespace
 
 bool AEBObjectTracker::Comparators::byCollisionTime(
     DetectedObject const &first_object, DetectedObject const &second_object) {
@@ -49,16 +76,15 @@ bool AEBObjectTracker::Comparators::byThreatLevel(
   return first_object.getThreatLevel() > second_object.getThreatLevel();
 }
 
+bool AEBObjectTracker::Comparators::byMultiCriteria(
+    DetectedObject const &first_object,
+    DetectedObject const &second_object) noexcept {
+  return multiCriteriaComparator(first_object, second_object);
+}
+
 // DetectedObject Implementation
 constexpr float DetectedObject::calculateThreatLevel() const noexcept {
-  if (collision_time_ > 10.0f)
-    return 0.0f;
-  if (collision_time_ < 1.0f)
-    return 1.0f;
-
-  const float distance_factor = std::max(0.0f, 1.0f - distance_ / 100.0f);
-  const float time_factor = std::max(0.0f, 1.0f - collision_time_ / 10.0f);
-  return (distance_factor + time_factor) / 2.0f;
+  return computeThreatLevel(distance_, collision_time_);
 }
 
 DetectedObject::DetectedObject(int obj_id, float dist, float rel_vel) noexcept
@@ -66,14 +92,20 @@ DetectedObject::DetectedObject(int obj_id, float dist, float rel_vel) noexcept
   // Calculate Time-To-Collision (TTC)
   // Formula: TTC = distance / |relative_velocity|
   // relative_velocity is negative, i.e., object is approaching.
-  collision_time_ = (relative_velocity_ < -0.1f)
-                        ? distance_ / (-relative_velocity_)
-                        : std::numeric_limits<float>::infinity();
+  collision_time_ = computeCollisionTime(distance_, relative_velocity_);
 
   // Calculate threat level based on distance and TTC
   threat_level_ = calculateThreatLevel();
 }
 
+DetectedObject::DetectedObject(int obj_id, float dist, float rel_vel,
+                               float rel_accel) noexcept
+    : id_{obj_id}, distance_{dist}, relative_velocity_{rel_vel} {
+  collision_time_ = computeCollisionTime(distance_, relative_velocity_,
+                                         rel_accel);
+  threat_level_ = calculateThreatLevel();
+}
+
 bool DetectedObject::operator<(const DetectedObject &other) const noexcept {
   return collision_time_ < other.collision_time_;
 }
@@ -83,17 +115,161 @@ bool DetectedObject::operator==(const DetectedObject &other) const noexcept {
 }
 
 /// @brief AEBObjectTracker Implementation
+AEBObjectTracker::AEBObjectTracker()
+    : AEBObjectTracker(std::pmr::get_default_resource()) {}
+
+AEBObjectTracker::AEBObjectTracker(std::pmr::memory_resource *resource)
+    : objects_{resource}, id_index_{resource}, critical_set_{0U, resource},
+      radix_sorter_{resource}, sort_keys_{resource}, sort_scratch_{resource},
+      merger_{resource} {}
+
 void AEBObjectTracker::addObject(const DetectedObject &object) {
   objects_.push_back(object);
+  if (id_index_enabled_) {
+    id_index_.insert(object.getId(), objects_.size() - 1U);
+  }
+  critical_set_.offer(object);
+}
+
+bool AEBObjectTracker::updateObject(int id, float distance,
+                                    float relative_velocity) {
+  const auto found = findObjectById(id);
+  if (found == objects_.end()) {
+    return false;
+  }
+
+  const DetectedObject updated(id, distance, relative_velocity);
+  objects_[static_cast<size_t>(found - objects_.begin())] = updated;
+  updateCriticalSet(updated);
+  return true;
+}
+
+size_t AEBObjectTracker::updateFrame(int const *ids, float const *distances,
+                                     float const *relative_velocities,
+                                     size_t count) {
+  size_t added = 0;
+  for (size_t i = 0; i < count; ++i) {
+    if (!updateObject(ids[i], distances[i], relative_velocities[i])) {
+      addObject(DetectedObject(ids[i], distances[i], relative_velocities[i]));
+      ++added;
+    }
+  }
+  return added;
+}
+
+void AEBObjectTracker::addObjects(int const *ids, float const *distances,
+                                  float const *velocities,
+                                  float const *accelerations, size_t count,
+                                  EgoMotion const &ego) {
+  // Chunks small enough for the stack, large enough for the kernel.
+  constexpr size_t kChunkSize = 256U;
+  std::array<float, kChunkSize> relative_velocities;
+  std::array<float, kChunkSize> collision_times;
+  std::array<float, kChunkSize> threat_levels;
+
+  for (size_t begin = 0; begin < count; begin += kChunkSize) {
+    const size_t chunk = std::min(kChunkSize, count - begin);
+    simd::computeCollisionTimes(distances + begin, velocities + begin,
+                                accelerations + begin, ego,
+                                relative_velocities.data(),
+                                collision_times.data(), threat_levels.data(),
+                                chunk);
+    for (size_t i = 0; i < chunk; ++i) {
+      addObject(DetectedObject::fromPrecomputed(
+          ids[begin + i], distances[begin + i], relative_velocities[i],
+          collision_times[i], threat_levels[i]));
+    }
+  }
+}
+
+size_t AEBObjectTracker::commitFrame(ObjectStaging &staging,
+                                     CommitOrder order) {
+  const size_t producers = staging.producerCount();
+  objects_.clear();
+  objects_.reserve(staging.stagedCount());
+
+  if (order == CommitOrder::kAsStaged) {
+    for (size_t p = 0; p < producers; ++p) {
+      const ObjectRange run = staging.getRun(p);
+      objects_.insert(objects_.end(), run.begin(), run.end());
+    }
+  } else {
+    // One thread per run; only worth it when the frame is large.
+    if (detail::parallelChunkCount(staging.stagedCount(),
+                                   ParallelSortOptions{}) > 1U) {
+      detail::runChunks(producers,
+                        [&staging](size_t p) { staging.sortRun(p); });
+    } else {
+      for (size_t p = 0; p < producers; ++p) {
+        staging.sortRun(p);
+      }
+    }
+
+    merger_.reset(producers);
+    for (size_t p = 0; p < producers; ++p) {
+      merger_.setRun(p, staging.getRun(p));
+    }
+    merger_.merge(staging.stagedCount(), Comparators::byCollisionTime,
+                  [this](DetectedObject const &object) {
+                    objects_.push_back(object);
+                  });
+  }
+
+  staging.clear();
+  onObjectsReordered();
+  rebuildCriticalSet();
+  return objects_.size();
+}
+
+size_t AEBObjectTracker::mergeSortedRuns(ObjectRange const *runs,
+                                         size_t run_count) {
+  return mergeSortedRuns(runs, run_count, std::numeric_limits<size_t>::max());
+}
+
+size_t AEBObjectTracker::mergeSortedRuns(ObjectRange const *runs,
+                                         size_t run_count,
+                                         size_t max_objects) {
+  size_t total = 0U;
+  for (size_t r = 0; r < run_count; ++r) {
+    total += runs[r].size();
+  }
+  objects_.clear();
+  objects_.reserve(std::min(total, max_objects));
+  merger_.merge(runs, run_count, max_objects, Comparators::byCollisionTime,
+                [this](DetectedObject const &object) {
+                  objects_.push_back(object);
+                });
+  onObjectsReordered();
+  rebuildCriticalSet();
+  return objects_.size();
+}
+
+void AEBObjectTracker::recordFrame(std::uint64_t timestamp_ns) {
+  if (recorder_ != nullptr) {
+    recorder_->endFrame(ObjectRange(objects_.data(), objects_.size()),
+                        timestamp_ns);
+  }
 }
 
 void AEBObjectTracker::reserveCapacity(size_t capacity) {
   objects_.reserve(capacity);
+  if (id_index_enabled_) {
+    id_index_.reserve(capacity);
+  }
+  if (sort_mode_ == SortMode::kRadixKey) {
+    radix_sorter_.reserve(capacity);
+    sort_keys_.reserve(capacity);
+    sort_scratch_.reserve(capacity);
+  }
 }
 
-void AEBObjectTracker::clear() noexcept { objects_.clear(); }
+void AEBObjectTracker::clear() noexcept {
+  objects_.clear();
+  id_index_.clear();
+  critical_set_.clear();
+}
 
-const std::vector<DetectedObject> &AEBObjectTracker::getObjects() const {
+const AEBObjectTracker::ObjectContainer &AEBObjectTracker::getObjects() const {
   return objects_;
 }
 
@@ -102,11 +278,64 @@ size_t AEBObjectTracker::size() const { return objects_.size(); }
 bool AEBObjectTracker::empty() const { return objects_.empty(); }
 
 void AEBObjectTracker::sortByCollisionTime() {
-  std::sort(objects_.begin(), objects_.end(), Comparators::byCollisionTime);
+  if (sort_mode_ == SortMode::kRadixKey) {
+    sort_keys_.resize(objects_.size());
+    for (size_t i = 0; i < objects_.size(); ++i) {
+      sort_keys_[i] = collisionTimeSortKey(objects_[i].getCollisionTime(),
+                                           objects_[i].getDistance());
+    }
+    sortBySortKeys();
+  } else {
+    std::sort(objects_.begin(), objects_.end(), Comparators::byCollisionTime);
+  }
+  onObjectsReordered();
+}
+
+void AEBObjectTracker::resortByCollisionTime() {
+  // Insertion sort is linear on nearly sorted input; beyond this many moves
+  // per object the input is not "nearly sorted" and introsort is cheaper.
+  constexpr size_t kMovesPerObject = 8U;
+  const size_t move_budget = objects_.size() * kMovesPerObject;
+  size_t moves = 0;
+
+  for (size_t i = 1; i < objects_.size(); ++i) {
+    if (!Comparators::byCollisionTime(objects_[i], objects_[i - 1U])) {
+      continue;
+    }
+    const DetectedObject object = objects_[i];
+    size_t j = i;
+    for (; j > 0U && Comparators::byCollisionTime(object, objects_[j - 1U]);
+         --j) {
+      objects_[j] = objects_[j - 1U];
+    }
+    objects_[j] = object;
+
+    moves += i - j;
+    if (moves > move_budget) {
+      std::sort(objects_.begin(), objects_.end(),
+                Comparators::byCollisionTime);
+      break;
+    }
+  }
+  onObjectsReordered();
+}
+
+void AEBObjectTracker::sortByCollisionTime(
+    ParallelSortOptions const &options) {
+  parallelStableSort(objects_.begin(), objects_.end(),
+                     Comparators::byCollisionTime, options);
+  onObjectsReordered();
 }
 
 void AEBObjectTracker::sortByThreatLevel() {
-  std::sort(objects_.begin(), objects_.end(), Comparators::byCollisionTime);
+  std::sort(objects_.begin(), objects_.end(), Comparators::byThreatLevel);
+  onObjectsReordered();
+}
+
+void AEBObjectTracker::sortByThreatLevel(ParallelSortOptions const &options) {
+  parallelStableSort(objects_.begin(), objects_.end(), byThreatLevelSortKey,
+                     options);
+  onObjectsReordered();
 }
 
 void AEBObjectTracker::partialSortCriticalObjects(size_t max_objects) {
@@ -114,23 +343,50 @@ void AEBObjectTracker::partialSortCriticalObjects(size_t max_objects) {
     return;
 
   const size_t num_to_sort = std::min(max_objects, objects_.size());
-  using diff_t = std::vector<DetectedObject>::difference_type;
+  using diff_t = ObjectContainer::difference_type;
 
   std::partial_sort(objects_.begin(),
                     objects_.begin() + static_cast<diff_t>(num_to_sort),
                     objects_.end(), Comparators::byCollisionTime);
+  onObjectsReordered();
+}
+
+void AEBObjectTracker::partialSortCriticalObjects(
+    size_t max_objects, ParallelSortOptions const &options) {
+  const size_t num_to_sort = std::min(max_objects, objects_.size());
+  using diff_t = ObjectContainer::difference_type;
+
+  parallelPartialSort(objects_.begin(),
+                      objects_.begin() + static_cast<diff_t>(num_to_sort),
+                      objects_.end(), Comparators::byCollisionTime, options);
+  onObjectsReordered();
 }
 
 void AEBObjectTracker::sortMultiCriteria() {
-  std::sort(objects_.begin(), objects_.end(), multiCriteriaComparator);
+  if (sort_mode_ == SortMode::kRadixKey) {
+    sort_keys_.resize(objects_.size());
+    for (size_t i = 0; i < objects_.size(); ++i) {
+      sort_keys_[i] = multiCriteriaSortKey(objects_[i].getThreatLevel(),
+                                           objects_[i].getCollisionTime(),
+                                           objects_[i].getDistance());
+    }
+    sortBySortKeys();
+  } else {
+    std::sort(objects_.begin(), objects_.end(), multiCriteriaComparator);
+  }
+  onObjectsReordered();
+}
+
+void AEBObjectTracker::sortMultiCriteria(ParallelSortOptions const &options) {
+  parallelStableSort(objects_.begin(), objects_.end(), byMultiCriteriaSortKey,
+                     options);
+  onObjectsReordered();
 }
 
 std::vector<DetectedObject>
 AEBObjectTracker::getCriticalObjects(size_t max_objects) const {
-  const size_t num_objects = std::min(max_objects, objects_.size());
-  using diff_t = std::vector<DetectedObject>::difference_type;
-  return std::vector<DetectedObject>(
-      objects_.begin(), objects_.begin() + static_cast<diff_t>(num_objects));
+  const ObjectRange critical = getCriticalObjectsView(max_objects);
+  return std::vector<DetectedObject>(critical.begin(), critical.end());
 }
 
 std::vector<DetectedObject>
@@ -141,28 +397,125 @@ AEBObjectTracker::getObjectsWithinTimeThreshold(float threshold_seconds) const {
   std::copy_if(objects_.begin(), objects_.end(),
                std::back_inserter(critical_objects),
                [threshold_seconds](const DetectedObject &obj) noexcept {
-                 return !std::isinf(obj.getCollisionTime()) &&
-                        obj.getCollisionTime() <= threshold_seconds;
+                 return isWithinCollisionTimeThreshold(obj.getCollisionTime(),
+                                                       threshold_seconds);
                });
 
   return critical_objects;
 }
 
-std::vector<DetectedObject>::const_iterator
+AEBObjectTracker::ObjectContainer
+AEBObjectTracker::getCriticalObjects(size_t max_objects,
+                                     std::pmr::memory_resource *resource) const {
+  const ObjectRange critical = getCriticalObjectsView(max_objects);
+  return ObjectContainer(critical.begin(), critical.end(), resource);
+}
+
+AEBObjectTracker::ObjectContainer
+AEBObjectTracker::getObjectsWithinTimeThreshold(
+    float threshold_seconds, std::pmr::memory_resource *resource) const {
+  // Count first so that the result is allocated once at its final size.
+  const ThresholdObjectRange within =
+      getObjectsWithinTimeThresholdView(threshold_seconds);
+  ObjectContainer critical_objects(resource);
+  critical_objects.reserve(within.count());
+  critical_objects.assign(within.begin(), within.end());
+  return critical_objects;
+}
+
+ObjectRange AEBObjectTracker::getCriticalObjectsView(
+    size_t max_objects) const noexcept {
+  if (max_objects <= critical_set_.capacity()) {
+    const ObjectRange critical = critical_set_.objects();
+    return ObjectRange(critical.data(), std::min(max_objects, critical.size()));
+  }
+  return ObjectRange(objects_.data(), std::min(max_objects, objects_.size()));
+}
+
+ThresholdObjectRange AEBObjectTracker::getObjectsWithinTimeThresholdView(
+    float threshold_seconds) const noexcept {
+  return ThresholdObjectRange(ObjectRange(objects_.data(), objects_.size()),
+                              threshold_seconds);
+}
+
+size_t AEBObjectTracker::getObjectIndicesWithinTimeThreshold(
+    float threshold_seconds, std::vector<size_t> &indices) const {
+  indices.clear();
+  for (size_t i = 0; i < objects_.size(); ++i) {
+    if (isWithinCollisionTimeThreshold(objects_[i].getCollisionTime(),
+                                       threshold_seconds)) {
+      indices.push_back(i);
+    }
+  }
+  return indices.size();
+}
+
+AEBObjectTracker::ObjectContainer::const_iterator
 AEBObjectTracker::findObjectById(int id) const noexcept {
+  if (id_index_enabled_) {
+    const size_t position = id_index_.find(id);
+    if (position == ObjectIdIndex::kNotFound) {
+      return objects_.end();
+    }
+    using diff_t = ObjectContainer::difference_type;
+    return objects_.begin() + static_cast<diff_t>(position);
+  }
   return std::find_if(
       objects_.begin(), objects_.end(),
       [id](const DetectedObject &obj) noexcept { return obj.getId() == id; });
 }
 
+void AEBObjectTracker::findObjectsByIds(std::vector<int> const &ids,
+                                        std::vector<size_t> &positions) const {
+  positions.resize(ids.size());
+  for (size_t i = 0; i < ids.size(); ++i) {
+    const auto found = findObjectById(ids[i]);
+    positions[i] = (found == objects_.end())
+                       ? ObjectIdIndex::kNotFound
+                       : static_cast<size_t>(found - objects_.begin());
+  }
+}
+
+void AEBObjectTracker::enableIdIndex(bool enabled) {
+  id_index_enabled_ = enabled;
+  id_index_.clear();
+  if (enabled) {
+    onObjectsReordered();
+  }
+}
+
 bool AEBObjectTracker::hasCriticalObjects(float threshold_seconds) const {
   return std::any_of(objects_.begin(), objects_.end(),
                      [threshold_seconds](const DetectedObject &obj) noexcept {
-                       return !std::isinf(obj.getCollisionTime()) &&
-                              obj.getCollisionTime() <= threshold_seconds;
+                       return isWithinCollisionTimeThreshold(
+                           obj.getCollisionTime(), threshold_seconds);
                      });
 }
 
+void AEBObjectTracker::classifyByThresholds(
+    std::vector<float> const &thresholds,
+    ThresholdClassification &classification, bool collect_indices) const {
+  classification.reset(thresholds, collect_indices);
+  for (size_t i = 0; i < objects_.size(); ++i) {
+    classification.record(i, objects_[i].getCollisionTime());
+  }
+}
+
+ThresholdClassification
+AEBObjectTracker::classifyByThresholds(std::vector<float> const &thresholds,
+                                       bool collect_indices) const {
+  ThresholdClassification classification;
+  classifyByThresholds(thresholds, classification, collect_indices);
+  return classification;
+}
+
+void AEBObjectTracker::forecastCriticalObjects(ForecastHorizon const &horizon,
+                                               CollisionForecast &forecast,
+                                               float ego_acceleration) const {
+  forecast.reset(horizon, ego_acceleration);
+  forecast.project(ObjectRange(objects_.data(), objects_.size()));
+}
+
 void AEBObjectTracker::printObjects(const std::string &title) const {
   if (!title.empty()) {
     std::cout << "\n=== " << title << " ===\n";
@@ -186,5 +539,58 @@ void AEBObjectTracker::printObjects(const std::string &title) const {
   }
 }
 
+void AEBObjectTracker::setIncrementalCriticalObjects(size_t max_objects) {
+  critical_set_.setCapacity(max_objects);
+  rebuildCriticalSet();
+}
+
+void AEBObjectTracker::sortBySortKeys() {
+  auto const &order = radix_sorter_.sort(sort_keys_.data(), sort_keys_.size());
+  sort_scratch_.resize(objects_.size());
+  for (size_t i = 0; i < order.size(); ++i) {
+    sort_scratch_[i] = objects_[order[i]];
+  }
+  objects_.swap(sort_scratch_);
+}
+
+void AEBObjectTracker::onObjectsReordered() {
+  if (id_index_enabled_) {
+    id_index_.clear();
+    id_index_.reserve(objects_.size());
+    for (size_t i = 0; i < objects_.size(); ++i) {
+      id_index_.insert(objects_[i].getId(), i);
+    }
+  }
+}
+
+void AEBObjectTracker::updateCriticalSet(DetectedObject const &updated) {
+  if (critical_set_.capacity() == 0U) {
+    return;
+  }
+
+  // Every object outside a full set is at most as critical as its last
+  // entry. A member that became less critical than that entry may have been
+  // overtaken by an outsider, which only a rescan can find.
+  const bool was_full = critical_set_.full();
+  const DetectedObject last_entry =
+      was_full ? critical_set_.objects()[critical_set_.size() - 1U]
+               : DetectedObject();
+  const bool was_member = critical_set_.remove(updated.getId());
+
+  if (was_member && was_full &&
+      Comparators::byCollisionTime(last_entry, updated)) {
+    rebuildCriticalSet();
+    return;
+  }
+  critical_set_.offer(updated);
+}
+
+void AEBObjectTracker::rebuildCriticalSet() {
+  critical_set_.clear();
+  for (auto const &object : objects_) {
+    critical_set_.offer(object);
+  }
+}
+
 } // namespace object_tracking
 } // namespace aeb
@@ -45,7 +45,7 @@ void demonstrateAEBSystem() {
   // Get critical objects for immediate action
   std::cout << "\n🚨 Analyzing Critical Objects (Partial Sort)...\n";
   aeb_system.partialSortCriticalObjects(3);
-  const auto critical_objects = aeb_system.getCriticalObjects(3);
+  const auto critical_objects = aeb_system.getCriticalObjectsView(3);
 
   std::cout << "\nTop 3 Critical Objects requiring immediate attention:\n";
   for (size_t i = 0; i < critical_objects.size(); ++i) {
@@ -56,23 +56,28 @@ void demonstrateAEBSystem() {
               << ", Threat: " << obj.getThreatLevel() << std::endl;
   }
 
-  // Decision making based on critical objects using modern algorithms
+  // Decision making based on critical objects: one fused pass answers both
+  // thresholds of this control cycle
   constexpr float kCriticalTimeThreshold = 2.0f;
   constexpr float kWarningTimeThreshold = 5.0f;
+  constexpr size_t kCriticalBand = 0U;
+  constexpr size_t kWarningBand = 1U;
 
-  if (aeb_system.hasCriticalObjects(kCriticalTimeThreshold)) {
+  const auto classification = aeb_system.classifyByThresholds(
+      {kCriticalTimeThreshold, kWarningTimeThreshold});
+
+  if (classification.anyWithin(kCriticalBand)) {
     std::cout
         << "\n⚠️  CRITICAL: Collision imminent! Applying emergency braking!\n";
-  } else if (aeb_system.hasCriticalObjects(kWarningTimeThreshold)) {
+  } else if (classification.anyWithin(kWarningBand)) {
     std::cout << "\n⚠️  WARNING: Close object detected. Pre-charging brakes.\n";
   } else {
     std::cout << "\n✅ All clear. Normal driving conditions.\n";
   }
 
   // Demonstrate advanced queries
-  const auto objects_within_2s = aeb_system.getObjectsWithinTimeThreshold(2.0f);
   std::cout << "\nObjects within 2-second collision threshold: "
-            << objects_within_2s.size() << std::endl;
+            << classification.countWithin(kCriticalBand) << std::endl;
 }
 
 } // namespace output
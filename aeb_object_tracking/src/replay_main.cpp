@@ -0,0 +1,317 @@
+/// @file replay_main.cpp
+/// @brief Offline replay driver: runs the tracker pipeline over recorded or
+/// synthetic frames and reports throughput and per-frame latency.
+
+#include <algorithm>  // for max
+#include <chrono>     // for steady_clock, duration
+#include <cstddef>    // for size_t
+#include <cstdint>    // for uint64_t
+#include <exception>  // for exception
+#include <iomanip>    // for setprecision
+#include <iostream>   // for cout, cerr
+#include <memory>     // for unique_ptr, make_unique
+#include <string>     // for string, stoul, stoi
+#include <thread>     // for thread
+#include <utility>    // for move
+#include <vector>     // for vector
+#include "aeb_frame_log.h"          // for FrameLogReader, LoggedFrame, ...
+#include "aeb_latency_histogram.h"  // for FrameLatencyProfile, ScopedLaten...
+#include "aeb_scenario_generator.h" // for ScenarioGenerator, ScenarioType
+#include "aeb_tracker.h"            // for AEBObjectTracker
+
+#if defined(__linux__)
+#include <pthread.h>  // for pthread_setaffinity_np, pthread_self
+#include <sched.h>    // for cpu_set_t, CPU_ZERO, CPU_SET
+#endif
+
+namespace aeb {
+namespace object_tracking {
+namespace replay {
+
+/// @brief Command line configuration.
+struct ReplayOptions {
+  std::vector<std::string> log_paths;   ///< Recorded drives, in order
+  std::size_t synthetic_frames{1000U};  ///< Used when no log is given
+  std::size_t synthetic_objects{1000U}; ///< Objects per synthetic frame
+  ScenarioType scenario{ScenarioType::kMixed}; ///< Synthetic traffic
+  std::size_t repeat{1U};               ///< Passes over the frames
+  std::size_t parallel{1U};             ///< Independent concurrent replays
+  int pin_cpu{-1};                      ///< First core to pin to, -1: none
+  std::size_t critical_objects{5U};     ///< K of partialSortCriticalObjects
+};
+
+/// @brief Outcome of one replay.
+struct ReplayResult {
+  FrameLatencyProfile profile;
+  std::size_t frames{0U};
+  std::size_t objects{0U};
+  std::size_t braking_frames{0U};
+  std::size_t warning_frames{0U};
+  double seconds{0.0};
+  bool pinned{false};
+};
+
+constexpr float kCriticalTimeThreshold = 2.0f;
+constexpr float kWarningTimeThreshold = 5.0f;
+constexpr std::size_t kCriticalBand = 0U;
+constexpr std::size_t kWarningBand = 1U;
+
+void printUsage() {
+  std::cout
+      << "Usage: aeb_replay [options] [frame_log ...]\n"
+         "Replays recorded frame logs (or synthetic frames if none are\n"
+         "given) through ingest, partialSortCriticalObjects and the\n"
+         "threshold decision, and reports throughput and latency.\n\n"
+         "Options:\n"
+         "  --frames N     Synthetic frames (default 1000)\n"
+         "  --objects N    Objects per synthetic frame (default 1000)\n"
+         "  --scenario S   Synthetic traffic: highway, urban, cut-in,\n"
+         "                 stationary or mixed (default mixed)\n"
+         "  --repeat N     Passes over all frames (default 1)\n"
+         "  --parallel N   Concurrent independent replays (default 1)\n"
+         "  --pin CPU      Pin replay i to core CPU + i (Linux only)\n"
+         "  --critical K   Critical objects to sort per frame (default 5)\n"
+         "  --help         Show this help\n";
+}
+
+/// @return false if name is not a scenario name.
+bool parseScenario(std::string const &name, ScenarioType &type) {
+  for (const ScenarioType candidate :
+       {ScenarioType::kHighwayPlatoon, ScenarioType::kUrbanClutter,
+        ScenarioType::kCutIn, ScenarioType::kStationaryClutter,
+        ScenarioType::kMixed}) {
+    if (name == toString(candidate)) {
+      type = candidate;
+      return true;
+    }
+  }
+  return false;
+}
+
+/// @return false (after printing usage) on invalid arguments.
+bool parseOptions(int argc, char **argv, ReplayOptions &options,
+                  bool &show_help) {
+  for (int i = 1; i < argc; ++i) {
+    const std::string arg = argv[i];
+    if (arg == "--help" || arg == "-h") {
+      show_help = true;
+      return true;
+    }
+    const bool has_value = i + 1 < argc;
+    if (arg == "--frames" && has_value) {
+      options.synthetic_frames = std::stoul(argv[++i]);
+    } else if (arg == "--objects" && has_value) {
+      options.synthetic_objects = std::stoul(argv[++i]);
+    } else if (arg == "--scenario" && has_value) {
+      if (!parseScenario(argv[++i], options.scenario)) {
+        std::cerr << "Unknown scenario: " << argv[i] << "\n";
+        return false;
+      }
+    } else if (arg == "--repeat" && has_value) {
+      options.repeat = std::stoul(argv[++i]);
+    } else if (arg == "--parallel" && has_value) {
+      options.parallel = std::stoul(argv[++i]);
+    } else if (arg == "--pin" && has_value) {
+      options.pin_cpu = std::stoi(argv[++i]);
+    } else if (arg == "--critical" && has_value) {
+      options.critical_objects = std::stoul(argv[++i]);
+    } else if (arg.rfind("--", 0) == 0) {
+      std::cerr << "Unknown or incomplete option: " << arg << "\n";
+      return false;
+    } else {
+      options.log_paths.push_back(arg);
+    }
+  }
+  return options.repeat > 0U && options.parallel > 0U;
+}
+
+/// @brief Pin the calling thread to one core.
+/// @return false if pinning is unsupported or failed.
+bool pinToCpu(int cpu) {
+#if defined(__linux__)
+  cpu_set_t cpus;
+  CPU_ZERO(&cpus);
+  CPU_SET(static_cast<std::size_t>(cpu), &cpus);
+  return pthread_setaffinity_np(pthread_self(), sizeof(cpus), &cpus) == 0;
+#else
+  static_cast<void>(cpu);
+  return false;
+#endif
+}
+
+/// @brief Frames of a fixed-seed scenario, laid out like a mapped log.
+std::vector<LoggedObject> makeSyntheticObjects(ReplayOptions const &options) {
+  ScenarioConfig config;
+  config.type = options.scenario;
+  config.object_count = options.synthetic_objects;
+  ScenarioGenerator generator(config);
+
+  std::vector<LoggedObject> objects;
+  objects.reserve(options.synthetic_frames * options.synthetic_objects);
+  for (std::size_t f = 0; f < options.synthetic_frames; ++f) {
+    for (auto const &object : generator.nextFrame()) {
+      objects.push_back(LoggedObject::fromDetectedObject(object));
+    }
+  }
+  return objects;
+}
+
+/// @brief Run the tracker pipeline over frames, repeat times.
+ReplayResult runReplay(std::vector<LoggedFrame> const &frames,
+                       ReplayOptions const &options, std::size_t replay) {
+  ReplayResult result;
+  if (options.pin_cpu >= 0) {
+    result.pinned = pinToCpu(options.pin_cpu + static_cast<int>(replay));
+  }
+
+  std::size_t max_objects = 0U;
+  for (auto const &frame : frames) {
+    max_objects = std::max(max_objects, frame.object_count);
+  }
+  AEBObjectTracker tracker;
+  tracker.reserveCapacity(max_objects);
+  ThresholdClassification classification;
+  const std::vector<float> thresholds = {kCriticalTimeThreshold,
+                                         kWarningTimeThreshold};
+
+  const auto start = std::chrono::steady_clock::now();
+  for (std::size_t pass = 0; pass < options.repeat; ++pass) {
+    for (auto const &frame : frames) {
+      ScopedLatencyTimer total_timer(result.profile.total);
+      {
+        ScopedLatencyTimer timer(result.profile.ingest);
+        loadLoggedFrame(frame, tracker);
+      }
+      {
+        ScopedLatencyTimer timer(result.profile.sort);
+        tracker.partialSortCriticalObjects(options.critical_objects);
+      }
+      {
+        ScopedLatencyTimer timer(result.profile.decision);
+        tracker.classifyByThresholds(thresholds, classification);
+        if (classification.anyWithin(kCriticalBand)) {
+          ++result.braking_frames;
+        } else if (classification.anyWithin(kWarningBand)) {
+          ++result.warning_frames;
+        }
+      }
+      ++result.frames;
+      result.objects += frame.object_count;
+    }
+  }
+  result.seconds = std::chrono::duration<double>(
+                       std::chrono::steady_clock::now() - start)
+                       .count();
+  return result;
+}
+
+void printThroughput(std::string const &title, std::size_t frames,
+                     std::size_t objects, double seconds) {
+  std::cout << std::fixed << std::setprecision(1) << "  " << title << ": "
+            << static_cast<double>(frames) / seconds << " frames/s, "
+            << static_cast<double>(objects) / seconds / 1e6
+            << " M objects/s (" << frames << " frames in "
+            << std::setprecision(3) << seconds << " s)\n";
+}
+
+int run(ReplayOptions const &options) {
+  // Every reader must stay open while frames point into its mapping.
+  std::vector<std::unique_ptr<FrameLogReader>> readers;
+  std::vector<LoggedObject> synthetic;
+  std::vector<LoggedFrame> frames;
+
+  if (options.log_paths.empty()) {
+    synthetic = makeSyntheticObjects(options);
+    for (std::size_t f = 0; f < options.synthetic_frames; ++f) {
+      frames.push_back(LoggedFrame{
+          f, synthetic.data() + f * options.synthetic_objects,
+          options.synthetic_objects});
+    }
+    std::cout << "Synthetic " << toString(options.scenario)
+              << " drive: " << options.synthetic_frames << " frames of "
+              << options.synthetic_objects << " objects\n";
+  }
+  for (auto const &path : options.log_paths) {
+    auto reader = std::make_unique<FrameLogReader>();
+    if (!reader->open(path)) {
+      std::cerr << "Cannot read frame log: " << path << "\n";
+      return 1;
+    }
+    std::cout << "Log " << path << ": " << reader->frameCount()
+              << " frames, " << reader->objectCount() << " objects\n";
+    for (std::size_t f = 0; f < reader->frameCount(); ++f) {
+      frames.push_back(reader->frame(f));
+    }
+    readers.push_back(std::move(reader));
+  }
+
+  std::vector<ReplayResult> results(options.parallel);
+  const auto start = std::chrono::steady_clock::now();
+  {
+    std::vector<std::thread> workers;
+    for (std::size_t r = 1; r < options.parallel; ++r) {
+      workers.emplace_back([&frames, &options, &results, r]() {
+        results[r] = runReplay(frames, options, r);
+      });
+    }
+    results[0] = runReplay(frames, options, 0U);
+    for (auto &worker : workers) {
+      worker.join();
+    }
+  }
+  const double wall_seconds =
+      std::chrono::duration<double>(std::chrono::steady_clock::now() - start)
+          .count();
+
+  FrameLatencyProfile combined;
+  std::size_t total_frames = 0U;
+  std::size_t total_objects = 0U;
+  std::cout << "\n📊 Throughput:\n";
+  for (std::size_t r = 0; r < results.size(); ++r) {
+    auto const &result = results[r];
+    printThroughput("Replay " + std::to_string(r) +
+                        (result.pinned ? " (pinned)" : ""),
+                    result.frames, result.objects, result.seconds);
+    combined.merge(result.profile);
+    total_frames += result.frames;
+    total_objects += result.objects;
+  }
+  if (results.size() > 1U) {
+    printThroughput("Aggregate", total_frames, total_objects, wall_seconds);
+  }
+
+  std::cout << "\n📊 Latency per frame:\n";
+  combined.printReport();
+  std::cout << "\nDecisions (replay 0): " << results[0].braking_frames
+            << " braking frames, " << results[0].warning_frames
+            << " warning frames\n";
+  return 0;
+}
+
+} // namespace replay
+} // namespace object_tracking
+} // namespace aeb
+
+/// @brief Replay driver entry point
+/// @return Exit status code
+int main(int argc, char **argv) {
+  namespace replay = aeb::object_tracking::replay;
+  try {
+    replay::ReplayOptions options;
+    bool show_help = false;
+    if (!replay::parseOptions(argc, argv, options, show_help)) {
+      replay::printUsage();
+      return 1;
+    }
+    if (show_help) {
+      replay::printUsage();
+      return 0;
+    }
+    return replay::run(options);
+
+  } catch (const std::exception &e) {
+    std::cerr << "\n❌ Replay failed with exception: " << e.what()
+              << std::endl;
+    return 1;
+  }
+}
@@ -0,0 +1,256 @@
+/// @file aeb_collision_forecast_test.cpp
+
+#include "../include/aeb_collision_forecast.h"
+#include "../include/aeb_scenario_generator.h"
+#include "../include/aeb_simd.h"
+#include "../include/aeb_tracker.h"
+#include "gtest/gtest.h"  // for AssertionResult, Test, Message, TestPartResult
+#include <cmath>          // for isinf, sqrt
+#include <cstddef>        // for size_t
+#include <map>            // for map
+#include <vector>         // for vector
+
+namespace aeb {
+namespace object_tracking {
+namespace test {
+
+namespace {
+
+/// @brief What a planner would do without the forecast: extrapolate a copy
+/// of the object by hand.
+DetectedObject extrapolate(DetectedObject const &object, float seconds) {
+  const bool reached = object.getCollisionTime() <= seconds;
+  const float distance =
+      reached ? 0.0f
+              : object.getDistance() + object.getRelativeVelocity() * seconds;
+  return DetectedObject(object.getId(), distance,
+                        object.getRelativeVelocity());
+}
+
+} // namespace
+
+TEST(CollisionForecast, MatchesExtrapolatedTrackerCopies) {
+  for (const ScenarioType type :
+       {ScenarioType::kUrbanClutter, ScenarioType::kCutIn,
+        ScenarioType::kMixed}) {
+    ScenarioConfig config;
+    config.type = type;
+    config.object_count = 3000U;
+    ScenarioGenerator generator(config);
+    AEBObjectTracker tracker;
+    for (auto const &object : generator.nextFrame()) {
+      tracker.addObject(object);
+    }
+    std::map<int, DetectedObject> by_id;
+    for (auto const &object : tracker.getObjects()) {
+      by_id[object.getId()] = object;
+    }
+
+    ForecastHorizon horizon;
+    horizon.step_seconds = 0.1f;
+    horizon.step_count = 5U;
+    horizon.max_objects = 8U;
+    CollisionForecast forecast;
+    tracker.forecastCriticalObjects(horizon, forecast);
+    ASSERT_EQ(forecast.stepCount(), 5U);
+
+    for (std::size_t s = 0; s < forecast.stepCount(); ++s) {
+      const float seconds = forecast.stepTime(s);
+      AEBObjectTracker copy;
+      for (auto const &object : tracker.getObjects()) {
+        copy.addObject(extrapolate(object, seconds));
+      }
+      copy.partialSortCriticalObjects(horizon.max_objects);
+      const ObjectRange expected =
+          copy.getCriticalObjectsView(horizon.max_objects);
+      const ObjectRange predicted = forecast.criticalObjects(s);
+
+      ASSERT_EQ(predicted.size(), expected.size()) << toString(type);
+      for (std::size_t i = 0; i < predicted.size(); ++i) {
+        // Equal TTCs may be listed in either order: compare the TTC
+        // sequence, and each prediction against its own object.
+        EXPECT_EQ(predicted[i].getCollisionTime(),
+                  expected[i].getCollisionTime())
+            << toString(type) << " step " << s << ", position " << i;
+        const DetectedObject reference =
+            extrapolate(by_id.at(predicted[i].getId()), seconds);
+        EXPECT_EQ(predicted[i].getDistance(), reference.getDistance());
+        EXPECT_EQ(predicted[i].getRelativeVelocity(),
+                  reference.getRelativeVelocity());
+        EXPECT_EQ(predicted[i].getCollisionTime(),
+                  reference.getCollisionTime());
+        EXPECT_EQ(predicted[i].getThreatLevel(), reference.getThreatLevel());
+      }
+    }
+  }
+}
+
+TEST(CollisionForecast, ObjectsReachingEgoBecomeMostCritical) {
+  AEBObjectTracker tracker;
+  tracker.addObject(DetectedObject(1, 1.0f, -10.0f));  // TTC 0.1 s
+  tracker.addObject(DetectedObject(2, 30.0f, -10.0f)); // TTC 3 s
+  tracker.addObject(DetectedObject(3, 20.0f, 5.0f));   // Receding
+
+  ForecastHorizon horizon;
+  horizon.step_seconds = 0.2f;
+  horizon.step_count = 2U;
+  horizon.max_objects = 3U;
+  CollisionForecast forecast;
+  tracker.forecastCriticalObjects(horizon, forecast);
+
+  const ObjectRange first = forecast.criticalObjects(0U);
+  ASSERT_EQ(first.size(), 3U);
+  EXPECT_EQ(first[0].getId(), 1);
+  EXPECT_EQ(first[0].getDistance(), 0.0f);
+  EXPECT_EQ(first[0].getCollisionTime(), 0.0f);
+  EXPECT_EQ(first[0].getThreatLevel(), 1.0f);
+  EXPECT_EQ(first[1].getId(), 2);
+  EXPECT_FLOAT_EQ(first[1].getDistance(), 28.0f);
+  EXPECT_FLOAT_EQ(first[1].getCollisionTime(), 2.8f);
+  EXPECT_EQ(first[2].getId(), 3);
+  EXPECT_FLOAT_EQ(first[2].getDistance(), 21.0f);
+  EXPECT_TRUE(std::isinf(first[2].getCollisionTime()));
+
+  EXPECT_FLOAT_EQ(forecast.criticalObjects(1U)[1].getCollisionTime(), 2.6f);
+}
+
+TEST(CollisionForecast, EgoBrakingOpensTheGap) {
+  AEBObjectTracker tracker;
+  tracker.addObject(DetectedObject(1, 20.0f, -10.0f)); // TTC 2 s
+  ForecastHorizon horizon;
+  horizon.step_seconds = 0.5f;
+  horizon.step_count = 2U;
+  horizon.max_objects = 1U;
+  CollisionForecast forecast;
+
+  // Braking at 2 m/s^2: 20 - 10 t + t^2 = 0 -> contact at 5 - sqrt(5) s.
+  tracker.forecastCriticalObjects(horizon, forecast, -2.0f);
+  const DetectedObject mild = forecast.criticalObjects(0U)[0];
+  EXPECT_FLOAT_EQ(mild.getDistance(), 20.0f - 5.0f + 0.25f);
+  EXPECT_FLOAT_EQ(mild.getRelativeVelocity(), -9.0f);
+  EXPECT_NEAR(mild.getCollisionTime(), 5.0f - std::sqrt(5.0f) - 0.5f, 1e-4f);
+
+  // Braking at 3 m/s^2 stops the approach after 16.7 m: no collision.
+  tracker.forecastCriticalObjects(horizon, forecast, -3.0f);
+  EXPECT_TRUE(std::isinf(forecast.criticalObjects(0U)[0].getCollisionTime()));
+  EXPECT_TRUE(std::isinf(forecast.criticalObjects(1U)[0].getCollisionTime()));
+
+  // Accelerating towards it brings the collision forward.
+  tracker.forecastCriticalObjects(horizon, forecast, 2.0f);
+  EXPECT_LT(forecast.criticalObjects(0U)[0].getCollisionTime(), 1.5f);
+}
+
+TEST(CollisionForecast, ExtrapolatesWithStoredAccelerationCollisionTime) {
+  // Object 1 is at rest but accelerating towards the ego vehicle:
+  // 8 m at 25 m/s^2 are covered in 0.8 s.
+  const int ids[2] = {1, 2};
+  const float distances[2] = {8.0f, 30.0f};
+  const float velocities[2] = {0.0f, -10.0f};
+  const float accelerations[2] = {-25.0f, 0.0f};
+  AEBObjectTracker tracker;
+  tracker.addObjects(ids, distances, velocities, accelerations, 2U);
+  ASSERT_NEAR(tracker.getObjects()[0].getCollisionTime(), 0.8f, 1e-5f);
+
+  ForecastHorizon horizon;
+  horizon.step_seconds = 0.5f;
+  horizon.step_count = 2U;
+  horizon.max_objects = 2U;
+  CollisionForecast forecast;
+  tracker.forecastCriticalObjects(horizon, forecast);
+
+  // After 0.5 s: 8 - 25 * 0.25 / 2 = 4.875 m left at -12.5 m/s, which
+  // takes another 0.3 s.
+  const ObjectRange before = forecast.criticalObjects(0U);
+  ASSERT_EQ(before.size(), 2U);
+  EXPECT_EQ(before[0].getId(), 1);
+  EXPECT_NEAR(before[0].getDistance(), 4.875f, 1e-4f);
+  EXPECT_NEAR(before[0].getRelativeVelocity(), -12.5f, 1e-4f);
+  EXPECT_NEAR(before[0].getCollisionTime(), 0.3f, 1e-4f);
+  EXPECT_EQ(before[0].getThreatLevel(), 1.0f);
+  EXPECT_EQ(before[1].getId(), 2);
+  EXPECT_FLOAT_EQ(before[1].getCollisionTime(), 2.5f);
+
+  const ObjectRange after = forecast.criticalObjects(1U);
+  ASSERT_EQ(after.size(), 2U);
+  EXPECT_EQ(after[0].getId(), 1) << "Reached by its own acceleration.";
+  EXPECT_EQ(after[0].getDistance(), 0.0f);
+  EXPECT_EQ(after[0].getCollisionTime(), 0.0f);
+  EXPECT_EQ(after[0].getThreatLevel(), 1.0f);
+  EXPECT_EQ(after[1].getId(), 2);
+  EXPECT_FLOAT_EQ(after[1].getCollisionTime(), 2.0f);
+
+  // Ego braking at 1 m/s^2 adds to the object's own acceleration:
+  // 8 = 24 t^2 / 2 -> contact after sqrt(2 / 3) s.
+  tracker.forecastCriticalObjects(horizon, forecast, -1.0f);
+  const DetectedObject braking = forecast.criticalObjects(0U)[0];
+  EXPECT_EQ(braking.getId(), 1);
+  EXPECT_NEAR(braking.getCollisionTime(), std::sqrt(2.0f / 3.0f) - 0.5f,
+              1e-4f);
+  EXPECT_EQ(forecast.criticalObjects(1U)[0].getId(), 1);
+  EXPECT_EQ(forecast.criticalObjects(1U)[0].getCollisionTime(), 0.0f);
+}
+
+TEST(CollisionForecast, ResetReusesAndResizesSteps) {
+  AEBObjectTracker tracker;
+  for (int id = 0; id < 600; ++id) {
+    tracker.addObject(DetectedObject(id, 5.0f + static_cast<float>(id),
+                                     -10.0f));
+  }
+  CollisionForecast forecast;
+  ForecastHorizon horizon;
+  horizon.step_count = 6U;
+  horizon.max_objects = 4U;
+  tracker.forecastCriticalObjects(horizon, forecast);
+  EXPECT_EQ(forecast.stepCount(), 6U);
+  EXPECT_EQ(forecast.criticalObjects(5U).size(), 4U);
+  EXPECT_FLOAT_EQ(forecast.stepTime(5U), 0.3f);
+
+  horizon.step_count = 2U;
+  horizon.max_objects = 2U;
+  tracker.forecastCriticalObjects(horizon, forecast);
+  EXPECT_EQ(forecast.stepCount(), 2U);
+  EXPECT_EQ(forecast.criticalObjects(1U).size(), 2U);
+  EXPECT_EQ(forecast.criticalObjects(1U)[0].getId(), 0);
+
+  AEBObjectTracker empty;
+  empty.forecastCriticalObjects(horizon, forecast);
+  EXPECT_TRUE(forecast.criticalObjects(0U).empty());
+}
+
+TEST(CollisionForecast, ProjectionKernelMatchesScalar) {
+  std::vector<float> distances;
+  std::vector<float> velocities;
+  for (int i = 0; i < 203; ++i) {
+    distances.push_back(0.3f + static_cast<float>(i) * 0.71f);
+    velocities.push_back(-25.0f + static_cast<float>(i % 37));
+  }
+  const std::size_t count = distances.size();
+  std::vector<float> accelerations(count);
+  std::vector<float> collision_times(count);
+  for (std::size_t i = 0; i < count; ++i) {
+    accelerations[i] = -6.0f + static_cast<float>(i % 13) * 0.75f;
+    collision_times[i] =
+        computeCollisionTime(distances[i], velocities[i], accelerations[i]);
+  }
+
+  std::vector<float> vector_out(4U * count);
+  std::vector<float> scalar_out(4U * count);
+  simd::projectCollisionTimes(
+      distances.data(), velocities.data(), accelerations.data(),
+      collision_times.data(), count, 0.35f, vector_out.data(),
+      vector_out.data() + count, vector_out.data() + 2U * count,
+      vector_out.data() + 3U * count);
+  simd::projectCollisionTimesScalar(
+      distances.data(), velocities.data(), accelerations.data(),
+      collision_times.data(), count, 0.35f, scalar_out.data(),
+      scalar_out.data() + count, scalar_out.data() + 2U * count,
+      scalar_out.data() + 3U * count);
+  for (std::size_t i = 0; i < vector_out.size(); ++i) {
+    EXPECT_EQ(vector_out[i], scalar_out[i])
+        << simd::activeInstructionSet() << " at " << i;
+  }
+}
+
+} // namespace test
+} // namespace object_tracking
+} // namespace aeb
@@ -0,0 +1,113 @@
+/// @file aeb_columnar_tracker_test.cpp
+
+#include "../include/aeb_columnar_tracker.h"
+#include "../include/aeb_tracker.h"
+#include "gtest/gtest.h"  // for AssertionResult, Test, Message, TestPartResult
+
+namespace aeb {
+namespace object_tracking {
+namespace test {
+
+namespace {
+
+void addScenario(AEBObjectTracker &tracker, ColumnarObjectTracker &columnar) {
+  const DetectedObject objects[] = {
+      DetectedObject(1, 50.0f, -10.0f), // TTC = 5.0s
+      DetectedObject(2, 20.0f, -20.0f), // TTC = 1.0s
+      DetectedObject(3, 100.0f, 5.0f),  // TTC = INF
+      DetectedObject(4, 30.0f, -14.0f), // TTC = 2.14s
+      DetectedObject(5, 80.0f, -8.0f),  // TTC = 10.0s
+      DetectedObject(6, 60.0f, 0.0f),   // TTC = INF
+  };
+  for (auto const &object : objects) {
+    tracker.addObject(object);
+    columnar.addObject(object);
+  }
+}
+
+} // namespace
+
+TEST(ColumnarObjectTracker, SortByCollisionTimeMatchesAoSTracker) {
+  AEBObjectTracker tracker;
+  ColumnarObjectTracker columnar;
+  addScenario(tracker, columnar);
+
+  tracker.sortByCollisionTime();
+  columnar.sortByCollisionTime();
+
+  ASSERT_EQ(columnar.size(), tracker.size());
+  for (std::size_t i = 0; i < tracker.size(); ++i) {
+    EXPECT_EQ(columnar.getIds()[i], tracker.getObjects()[i].getId())
+        << "Columnar storage must produce the same collision time order at "
+           "position "
+        << i;
+  }
+}
+
+TEST(ColumnarObjectTracker, PartialSortKeepsColumnsAligned) {
+  AEBObjectTracker tracker;
+  ColumnarObjectTracker columnar;
+  addScenario(tracker, columnar);
+
+  columnar.partialSortCriticalObjects(2);
+  const auto critical = columnar.getCriticalObjects(2);
+
+  ASSERT_EQ(critical.size(), 2U);
+  EXPECT_EQ(critical[0].getId(), 2);
+  EXPECT_EQ(critical[1].getId(), 4);
+  for (std::size_t i = 0; i < columnar.size(); ++i) {
+    const DetectedObject object = columnar.getObject(i);
+    EXPECT_EQ(object.getCollisionTime(), columnar.getCollisionTimes()[i])
+        << "Every column must be permuted together.";
+  }
+}
+
+TEST(ColumnarObjectTracker, ThresholdQueriesMatchAoSTracker) {
+  AEBObjectTracker tracker;
+  ColumnarObjectTracker columnar;
+  addScenario(tracker, columnar);
+
+  for (float threshold : {0.5f, 2.0f, 5.0f, 15.0f}) {
+    EXPECT_EQ(columnar.hasCriticalObjects(threshold),
+              tracker.hasCriticalObjects(threshold));
+    EXPECT_EQ(columnar.getObjectsWithinTimeThreshold(threshold).size(),
+              tracker.getObjectsWithinTimeThreshold(threshold).size());
+  }
+
+  EXPECT_EQ(columnar.findObjectById(4), 3U);
+  EXPECT_EQ(columnar.findObjectById(999), ColumnarObjectTracker::kNotFound);
+}
+
+TEST(ColumnarObjectTracker, ObjectsKeepAccelerationCollisionTimes) {
+  const int ids[3] = {1, 2, 3};
+  const float distances[3] = {8.0f, 20.0f, 45.0f};
+  const float velocities[3] = {0.0f, -5.0f, -12.0f};
+  const float accelerations[3] = {-25.0f, -4.0f, 3.0f};
+  AEBObjectTracker tracker;
+  ColumnarObjectTracker columnar;
+  tracker.addObjects(ids, distances, velocities, accelerations, 3U);
+  columnar.addObjects(ids, distances, velocities, accelerations, 3U);
+
+  for (std::size_t i = 0; i < columnar.size(); ++i) {
+    const DetectedObject object = columnar.getObject(i);
+    EXPECT_EQ(object.getCollisionTime(), columnar.getCollisionTimes()[i]);
+    EXPECT_EQ(object.getCollisionTime(),
+              tracker.getObjects()[i].getCollisionTime());
+    EXPECT_EQ(object.getThreatLevel(),
+              tracker.getObjects()[i].getThreatLevel());
+  }
+
+  // Object 1 is at rest: only its acceleration makes it critical.
+  columnar.partialSortCriticalObjects(1U);
+  const auto critical = columnar.getCriticalObjects(1U);
+  ASSERT_EQ(critical.size(), 1U);
+  EXPECT_EQ(critical[0].getId(), 1);
+  EXPECT_NEAR(critical[0].getCollisionTime(), 0.8f, 1e-5f);
+  const auto within = columnar.getObjectsWithinTimeThreshold(1.0f);
+  ASSERT_EQ(within.size(), 1U);
+  EXPECT_EQ(within[0].getCollisionTime(), critical[0].getCollisionTime());
+}
+
+} // namespace test
+} // namespace object_tracking
+} // namespace aeb
@@ -0,0 +1,101 @@
+/// @file aeb_compact_object_test.cpp
+
+#include "../include/aeb_compact_object.h"
+#include "../include/aeb_tracker.h"
+#include "gtest/gtest.h"  // for AssertionResult, Test, Message, TestPartResult
+#include <algorithm>      // for sort
+#include <cmath>          // for isinf
+#include <vector>         // for vector
+
+namespace aeb {
+namespace object_tracking {
+namespace test {
+
+static_assert(CompactObject(1, 20.0f, -20.0f).getCollisionTimeCode() == 1000U);
+static_assert(CompactObject(0, 1.0f, -1.0f).getId() == 0);
+static_assert(CompactObject(CompactObject::kMaxId, 1.0f, -1.0f).getId() ==
+              65535);
+
+TEST(CompactObject, RoundTripWithinResolution) {
+  const DetectedObject original(4242, 37.129f, -12.345f);
+  const CompactObject compact = CompactObject::fromDetectedObject(original);
+  const DetectedObject restored = compact.toDetectedObject();
+
+  EXPECT_EQ(restored.getId(), 4242);
+  EXPECT_NEAR(restored.getDistance(), original.getDistance(), 0.0051f);
+  EXPECT_NEAR(restored.getRelativeVelocity(), original.getRelativeVelocity(),
+              0.0051f);
+  EXPECT_NEAR(compact.getCollisionTime(), original.getCollisionTime(),
+              0.0005f);
+  EXPECT_NEAR(compact.getThreatLevel(), original.getThreatLevel(), 0.001f);
+}
+
+TEST(CompactObject, KeepsAccelerationCollisionTime) {
+  // At rest but accelerating towards the ego vehicle: TTC 0.8 s instead of
+  // infinity.
+  const DetectedObject original(7, 8.0f, 0.0f, -25.0f);
+  const CompactObject compact = CompactObject::fromDetectedObject(original);
+  EXPECT_NEAR(compact.getCollisionTime(), original.getCollisionTime(),
+              0.0005f);
+  EXPECT_EQ(compact.getThreatLevel(), original.getThreatLevel());
+
+  const DetectedObject restored = compact.toDetectedObject();
+  EXPECT_EQ(restored.getCollisionTime(), compact.getCollisionTime());
+  EXPECT_EQ(restored.getThreatLevel(), compact.getThreatLevel());
+}
+
+TEST(CompactObject, IdBoundary) {
+  const DetectedObject largest(CompactObject::kMaxId, 10.0f, -5.0f);
+  EXPECT_EQ(CompactObject::fromDetectedObject(largest).toDetectedObject(),
+            largest);
+  EXPECT_DEBUG_DEATH(CompactObject(CompactObject::kMaxId + 1, 10.0f, -5.0f),
+                     "16 bits");
+  EXPECT_DEBUG_DEATH(CompactObject(-1, 10.0f, -5.0f), "16 bits");
+}
+
+TEST(CompactObject, InfiniteAndSaturatedCollisionTimes) {
+  const CompactObject receding(1, 50.0f, 3.0f);
+  EXPECT_TRUE(std::isinf(receding.getCollisionTime()));
+  EXPECT_EQ(receding.getCollisionTimeCode(), CompactObject::kInfiniteTime);
+
+  const CompactObject slow(2, 300.0f, -0.2f); // TTC = 1500 s
+  EXPECT_EQ(slow.getCollisionTimeCode(), CompactObject::kSaturatedTime);
+  EXPECT_TRUE(CompactObject::byCollisionTime(slow, receding))
+      << "Approaching objects stay ahead of receding ones.";
+
+  const CompactObject far_away(3, 5000.0f, -10.0f);
+  EXPECT_FLOAT_EQ(far_away.getDistance(), 327.67f) << "Distance saturates.";
+}
+
+TEST(CompactObject, SortKeyMatchesCollisionTimeOrder) {
+  std::vector<DetectedObject> objects;
+  for (int id = 0; id < 500; ++id) {
+    const float distance = 1.0f + static_cast<float>(id * 7919 % 997) * 0.25f;
+    const float velocity = 5.0f - static_cast<float>(id * 31 % 41);
+    objects.emplace_back(id, distance, velocity);
+  }
+  std::vector<CompactObject> compact;
+  for (auto const &object : objects) {
+    compact.push_back(CompactObject::fromDetectedObject(object));
+  }
+
+  std::sort(objects.begin(), objects.end(),
+            AEBObjectTracker::Comparators::byCollisionTime);
+  std::sort(compact.begin(), compact.end(), CompactObject::byCollisionTime);
+
+  for (std::size_t i = 0; i < objects.size(); ++i) {
+    if (compact[i].getCollisionTimeCode() >= CompactObject::kSaturatedTime) {
+      break; // Saturated and receding objects only keep their group order.
+    }
+    EXPECT_NEAR(compact[i].getCollisionTime(), objects[i].getCollisionTime(),
+                0.001f)
+        << "Position " << i;
+  }
+  EXPECT_TRUE(CompactObject::byCollisionTime(CompactObject(1, -1.0f, 4.0f),
+                                             CompactObject(2, 1.0f, 4.0f)))
+      << "Negative distances order below positive ones.";
+}
+
+} // namespace test
+} // namespace object_tracking
+} // namespace aeb
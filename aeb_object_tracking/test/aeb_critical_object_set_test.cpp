@@ -0,0 +1,78 @@
+/// @file aeb_critical_object_set_test.cpp
+
+#include "../include/aeb_critical_object_set.h"
+#include "../include/aeb_tracker.h"
+#include "gtest/gtest.h"  // for AssertionResult, Test, Message, TestPartResult
+
+namespace aeb {
+namespace object_tracking {
+namespace test {
+
+TEST(CriticalObjectSet, KeepsMostCriticalInOrder) {
+  CriticalObjectSet critical(3);
+
+  EXPECT_TRUE(critical.offer(DetectedObject(1, 50.0f, -10.0f)));  // 5.0s
+  EXPECT_TRUE(critical.offer(DetectedObject(2, 100.0f, 5.0f)));   // INF
+  EXPECT_TRUE(critical.offer(DetectedObject(3, 20.0f, -20.0f)));  // 1.0s
+  EXPECT_TRUE(critical.offer(DetectedObject(4, 30.0f, -15.0f)));  // 2.0s
+  EXPECT_FALSE(critical.offer(DetectedObject(5, 80.0f, -8.0f)))   // 10.0s
+      << "A full set rejects objects less critical than its last entry.";
+
+  ASSERT_EQ(critical.size(), 3U);
+  EXPECT_EQ(critical.objects()[0].getId(), 3);
+  EXPECT_EQ(critical.objects()[1].getId(), 4);
+  EXPECT_EQ(critical.objects()[2].getId(), 1);
+
+  EXPECT_TRUE(critical.remove(4));
+  EXPECT_FALSE(critical.remove(4));
+  EXPECT_EQ(critical.size(), 2U);
+}
+
+TEST(CriticalObjectSet, ZeroCapacityAdmitsNothing) {
+  CriticalObjectSet critical;
+  EXPECT_FALSE(critical.offer(DetectedObject(1, 5.0f, -10.0f)));
+  EXPECT_TRUE(critical.empty());
+}
+
+TEST(AEBObjectTrackerIncrementalTopK, CorrectWithoutPartialSort) {
+  AEBObjectTracker tracker;
+  tracker.setIncrementalCriticalObjects(3);
+  for (int id = 0; id < 50; ++id) {
+    const float distance = 5.0f + static_cast<float>(id * 37 % 50);
+    const float velocity = -2.0f - static_cast<float>(id % 7);
+    tracker.addObject(DetectedObject(id, distance, velocity));
+  }
+
+  const auto incremental = tracker.getCriticalObjects(3);
+
+  AEBObjectTracker reference;
+  for (auto const &object : tracker.getObjects()) {
+    reference.addObject(object);
+  }
+  reference.partialSortCriticalObjects(3);
+  const auto expected = reference.getCriticalObjects(3);
+
+  ASSERT_EQ(incremental.size(), expected.size());
+  for (std::size_t i = 0; i < expected.size(); ++i) {
+    EXPECT_EQ(incremental[i].getCollisionTime(),
+              expected[i].getCollisionTime());
+  }
+
+  tracker.clear();
+  EXPECT_TRUE(tracker.getCriticalObjectsView(3).empty());
+}
+
+TEST(AEBObjectTrackerIncrementalTopK, LargerRequestsUseSortedPrefix) {
+  AEBObjectTracker tracker;
+  tracker.addObject(DetectedObject(1, 50.0f, -10.0f));
+  tracker.addObject(DetectedObject(2, 20.0f, -20.0f));
+  tracker.setIncrementalCriticalObjects(1);
+
+  EXPECT_EQ(tracker.getCriticalObjects(1)[0].getId(), 2)
+      << "Enabling the mode picks up objects that are already tracked.";
+  EXPECT_EQ(tracker.getCriticalObjects(2).size(), 2U);
+}
+
+} // namespace test
+} // namespace object_tracking
+} // namespace aeb
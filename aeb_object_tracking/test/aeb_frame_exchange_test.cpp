@@ -0,0 +1,110 @@
+/// @file aeb_frame_exchange_test.cpp
+
+#include "../include/aeb_frame_exchange.h"
+#include "gtest/gtest.h"  // for AssertionResult, Test, Message, TestPartResult
+#include <cstdint>        // for uint64_t
+#include <thread>         // for thread
+
+namespace aeb {
+namespace object_tracking {
+namespace test {
+
+namespace {
+
+/// Fill a frame whose objects all carry the frame number as ID.
+void buildFrame(AEBObjectTracker &frame, int frame_number, int object_count) {
+  frame.clear();
+  for (int i = 0; i < object_count; ++i) {
+    frame.addObject(DetectedObject(frame_number,
+                                   1.0f + static_cast<float>(i % 97),
+                                   -1.0f - static_cast<float>(i % 13)));
+  }
+  frame.sortByCollisionTime();
+}
+
+} // namespace
+
+TEST(TrackerFrameExchange, ConsumerSeesLatestPublishedFrame) {
+  TrackerFrameExchange exchange;
+  EXPECT_FALSE(exchange.acquire()) << "Nothing published yet.";
+  EXPECT_EQ(exchange.readSequence(), 0U);
+  EXPECT_EQ(exchange.readFrame().size(), 0U);
+
+  buildFrame(exchange.writeFrame(), 1, 10);
+  EXPECT_EQ(exchange.publish(), 1U);
+  ASSERT_TRUE(exchange.acquire());
+  EXPECT_EQ(exchange.readSequence(), 1U);
+  EXPECT_EQ(exchange.readFrame().size(), 10U);
+  EXPECT_FALSE(exchange.acquire()) << "Frame 1 was already acquired.";
+
+  // The consumer skips frame 2 and gets frame 3.
+  buildFrame(exchange.writeFrame(), 2, 20);
+  exchange.publish();
+  buildFrame(exchange.writeFrame(), 3, 30);
+  exchange.publish();
+  EXPECT_EQ(exchange.readFrame().size(), 10U)
+      << "The held frame is untouched by the producer.";
+  ASSERT_TRUE(exchange.acquire());
+  EXPECT_EQ(exchange.readSequence(), 3U);
+  EXPECT_EQ(exchange.readFrame().size(), 30U);
+  EXPECT_EQ(exchange.readFrame().getObjects().front().getId(), 3);
+}
+
+TEST(TrackerFrameExchange, ForEachFrameConfiguresAllSlots) {
+  TrackerFrameExchange exchange;
+  exchange.forEachFrame(
+      [](AEBObjectTracker &frame) { frame.enableIdIndex(true); });
+  EXPECT_TRUE(exchange.readFrame().isIdIndexEnabled())
+      << "The slot held by the consumer must be configured too.";
+  for (int frame_number = 1; frame_number <= 3; ++frame_number) {
+    buildFrame(exchange.writeFrame(), frame_number, 5);
+    EXPECT_TRUE(exchange.writeFrame().isIdIndexEnabled());
+    exchange.publish();
+    ASSERT_TRUE(exchange.acquire());
+    EXPECT_TRUE(exchange.readFrame().isIdIndexEnabled());
+  }
+}
+
+TEST(TrackerFrameExchange, ConcurrentFramesAreConsistent) {
+  constexpr int kFrames = 2000;
+  constexpr int kObjects = 64;
+  TrackerFrameExchange exchange;
+  exchange.forEachFrame(
+      [](AEBObjectTracker &frame) { frame.reserveCapacity(kObjects); });
+
+  std::thread producer([&exchange] {
+    for (int frame_number = 1; frame_number <= kFrames; ++frame_number) {
+      buildFrame(exchange.writeFrame(), frame_number, kObjects);
+      exchange.publish();
+    }
+  });
+
+  std::uint64_t last_sequence = 0U;
+  int torn_frames = 0;
+  while (last_sequence < static_cast<std::uint64_t>(kFrames)) {
+    if (!exchange.acquire()) {
+      std::this_thread::yield();
+      continue;
+    }
+    EXPECT_GT(exchange.readSequence(), last_sequence);
+    last_sequence = exchange.readSequence();
+    auto const &objects = exchange.readFrame().getObjects();
+    if (objects.size() != static_cast<std::size_t>(kObjects)) {
+      ++torn_frames;
+      continue;
+    }
+    for (auto const &object : objects) {
+      if (static_cast<std::uint64_t>(object.getId()) != last_sequence) {
+        ++torn_frames;
+        break;
+      }
+    }
+  }
+  producer.join();
+
+  EXPECT_EQ(torn_frames, 0) << "Every frame is seen exactly as published.";
+}
+
+} // namespace test
+} // namespace object_tracking
+} // namespace aeb
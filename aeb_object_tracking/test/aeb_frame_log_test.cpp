@@ -0,0 +1,187 @@
+/// @file aeb_frame_log_test.cpp
+
+#include "../include/aeb_frame_log.h"
+#include "../include/aeb_tracker.h"
+#include "gtest/gtest.h"  // for AssertionResult, Test, Message, TestPartResult
+#include <cstdint>        // for uint64_t
+#include <filesystem>     // for path, temp_directory_path, remove, resize_file
+#include <fstream>        // for ofstream
+#include <string>         // for string
+#include <vector>         // for vector
+
+namespace aeb {
+namespace object_tracking {
+namespace test {
+
+namespace {
+
+/// Log file in the temp directory, removed at the end of the test.
+class TempLog {
+public:
+  explicit TempLog(std::string const &name)
+      : path_{std::filesystem::temp_directory_path() / name} {}
+  ~TempLog() { std::filesystem::remove(path_); }
+
+  std::string path() const { return path_.string(); }
+
+private:
+  std::filesystem::path path_;
+};
+
+constexpr std::uint64_t kFramePeriodNs = 50000000U; // 20 Hz
+
+/// Record three frames of 0, 10 and 20 objects through a tracker.
+void recordDrive(std::string const &path) {
+  FrameRecorder recorder(path);
+  AEBObjectTracker tracker;
+  tracker.setFrameRecorder(&recorder);
+  for (int frame = 0; frame < 3; ++frame) {
+    tracker.clear();
+    for (int i = 0; i < frame * 10; ++i) {
+      tracker.addObject(DetectedObject(frame * 100 + i,
+                                       5.0f + static_cast<float>(i),
+                                       -1.5f * static_cast<float>(frame)));
+    }
+    tracker.recordFrame(static_cast<std::uint64_t>(frame) * kFramePeriodNs);
+  }
+  EXPECT_TRUE(recorder.good());
+  EXPECT_EQ(recorder.frameCount(), 3U);
+}
+
+} // namespace
+
+TEST(FrameLog, RecordAndReplay) {
+  const TempLog log("aeb_frame_log_record_replay.bin");
+  recordDrive(log.path());
+
+  FrameLogReader reader;
+  ASSERT_TRUE(reader.open(log.path()));
+  ASSERT_EQ(reader.frameCount(), 3U);
+  EXPECT_EQ(reader.objectCount(), 30U);
+
+  AEBObjectTracker replay;
+  for (std::size_t f = 0; f < reader.frameCount(); ++f) {
+    const LoggedFrame frame = reader.frame(f);
+    EXPECT_EQ(frame.timestamp_ns, f * kFramePeriodNs);
+    ASSERT_EQ(frame.object_count, f * 10U);
+    loadLoggedFrame(frame, replay);
+    ASSERT_EQ(replay.size(), frame.object_count);
+    for (std::size_t i = 0; i < replay.size(); ++i) {
+      const int frame_number = static_cast<int>(f);
+      const int index = static_cast<int>(i);
+      EXPECT_EQ(replay.getObjects()[i],
+                DetectedObject(frame_number * 100 + index,
+                               5.0f + static_cast<float>(index),
+                               -1.5f * static_cast<float>(frame_number)));
+    }
+  }
+}
+
+TEST(FrameLog, ReplayMatchesTrackerAfterUpdates) {
+  const TempLog log("aeb_frame_log_updates.bin");
+  // Frame 0 creates tracks 1-3; frame 1 moves them and adds track 4.
+  const int ids[2][4] = {{1, 2, 3, 0}, {3, 1, 4, 2}};
+  const float distances[2][4] = {{40.0f, 25.0f, 60.0f, 0.0f},
+                                 {52.0f, 38.0f, 15.0f, 24.0f}};
+  const float velocities[2][4] = {{-8.0f, -2.0f, 1.0f, 0.0f},
+                                  {-6.0f, -9.0f, -3.0f, 0.5f}};
+  const std::size_t counts[2] = {3U, 4U};
+
+  AEBObjectTracker tracker;
+  std::vector<DetectedObject> expected[2];
+  {
+    FrameRecorder recorder(log.path());
+    tracker.setFrameRecorder(&recorder);
+    for (std::size_t f = 0; f < 2U; ++f) {
+      tracker.updateFrame(ids[f], distances[f], velocities[f], counts[f]);
+      tracker.recordFrame(f * kFramePeriodNs);
+      expected[f].assign(tracker.getObjects().begin(),
+                         tracker.getObjects().end());
+    }
+    tracker.setFrameRecorder(nullptr);
+  }
+
+  FrameLogReader reader;
+  ASSERT_TRUE(reader.open(log.path()));
+  ASSERT_EQ(reader.frameCount(), 2U);
+  AEBObjectTracker replay;
+  for (std::size_t f = 0; f < 2U; ++f) {
+    loadLoggedFrame(reader.frame(f), replay);
+    ASSERT_EQ(replay.size(), expected[f].size()) << "Frame " << f;
+    for (std::size_t i = 0; i < replay.size(); ++i) {
+      DetectedObject const &replayed = replay.getObjects()[i];
+      EXPECT_EQ(replayed.getId(), expected[f][i].getId());
+      EXPECT_EQ(replayed.getDistance(), expected[f][i].getDistance());
+      EXPECT_EQ(replayed.getRelativeVelocity(),
+                expected[f][i].getRelativeVelocity());
+      EXPECT_EQ(replayed.getCollisionTime(),
+                expected[f][i].getCollisionTime());
+    }
+  }
+  ASSERT_EQ(reader.frame(1U).object_count, 4U)
+      << "Updated tracks are part of the frame, not only the new one.";
+  EXPECT_EQ(reader.frame(1U).objects[0].id, 1);
+  EXPECT_EQ(reader.frame(1U).objects[0].distance, 38.0f);
+}
+
+TEST(FrameLog, ReplayKeepsAccelerationCollisionTimes) {
+  const TempLog log("aeb_frame_log_acceleration.bin");
+  const int ids[3] = {1, 2, 3};
+  const float distances[3] = {20.0f, 8.0f, 45.0f};
+  const float velocities[3] = {-5.0f, 0.0f, -12.0f};
+  const float accelerations[3] = {-4.0f, -25.0f, 3.0f};
+
+  AEBObjectTracker tracker;
+  {
+    FrameRecorder recorder(log.path());
+    tracker.setFrameRecorder(&recorder);
+    tracker.addObjects(ids, distances, velocities, accelerations, 3U);
+    tracker.recordFrame(0U);
+    tracker.setFrameRecorder(nullptr);
+  }
+
+  FrameLogReader reader;
+  ASSERT_TRUE(reader.open(log.path()));
+  AEBObjectTracker replay;
+  loadLoggedFrame(reader.frame(0U), replay);
+  ASSERT_EQ(replay.size(), 3U);
+  for (std::size_t i = 0; i < replay.size(); ++i) {
+    DetectedObject const &recorded = tracker.getObjects()[i];
+    DetectedObject const &replayed = replay.getObjects()[i];
+    EXPECT_NE(recorded.getCollisionTime(),
+              computeCollisionTime(recorded.getDistance(),
+                                   recorded.getRelativeVelocity()))
+        << "Object " << recorded.getId() << " must depend on acceleration.";
+    EXPECT_EQ(replayed.getCollisionTime(), recorded.getCollisionTime());
+    EXPECT_EQ(replayed.getThreatLevel(), recorded.getThreatLevel());
+  }
+}
+
+TEST(FrameLog, TruncatedLastFrameIsIgnored) {
+  const TempLog log("aeb_frame_log_truncated.bin");
+  recordDrive(log.path());
+  const auto size = std::filesystem::file_size(log.path());
+  std::filesystem::resize_file(log.path(), size - 5U);
+
+  FrameLogReader reader;
+  ASSERT_TRUE(reader.open(log.path()));
+  EXPECT_EQ(reader.frameCount(), 2U);
+  EXPECT_EQ(reader.objectCount(), 10U);
+}
+
+TEST(FrameLog, RejectsInvalidFiles) {
+  FrameLogReader reader;
+  EXPECT_FALSE(reader.open("/nonexistent/aeb_frame_log.bin"));
+
+  const TempLog log("aeb_frame_log_invalid.bin");
+  {
+    std::ofstream file(log.path(), std::ios::binary);
+    file << "not a frame log, just some text";
+  }
+  EXPECT_FALSE(reader.open(log.path()));
+  EXPECT_FALSE(reader.isOpen());
+}
+
+} // namespace test
+} // namespace object_tracking
+} // namespace aeb
@@ -0,0 +1,142 @@
+/// @file aeb_kway_merge_test.cpp
+
+#include "../include/aeb_kway_merge.h"
+#include "../include/aeb_tracker.h"
+#include "gtest/gtest.h"  // for AssertionResult, Test, Message, TestPartResult
+#include <algorithm>      // for sort, stable_sort
+#include <cstddef>        // for size_t
+#include <vector>         // for vector
+
+namespace aeb {
+namespace object_tracking {
+namespace test {
+
+namespace {
+
+/// Sorted runs of different lengths with many equal TTCs across runs.
+std::vector<std::vector<DetectedObject>> makeSortedRuns() {
+  std::vector<std::vector<DetectedObject>> runs(5U);
+  for (std::size_t r = 0; r < runs.size(); ++r) {
+    const int length = r == 2U ? 0 : 40 + static_cast<int>(r) * 37;
+    for (int i = 0; i < length; ++i) {
+      const int id = static_cast<int>(r) * 1000 + i;
+      const float distance = 1.0f + static_cast<float>((id * 7919) % 97);
+      const float velocity = i % 11 == 0 ? 2.0f : -1.0f;
+      runs[r].emplace_back(id, distance, velocity);
+    }
+    std::stable_sort(runs[r].begin(), runs[r].end(),
+                     AEBObjectTracker::Comparators::byCollisionTime);
+  }
+  return runs;
+}
+
+std::vector<ObjectRange>
+toRanges(std::vector<std::vector<DetectedObject>> const &runs) {
+  std::vector<ObjectRange> ranges;
+  for (auto const &run : runs) {
+    ranges.emplace_back(run.data(), run.size());
+  }
+  return ranges;
+}
+
+/// Stable sort of the concatenation: the order a stable k-way merge gives.
+std::vector<int>
+expectedIds(std::vector<std::vector<DetectedObject>> const &runs) {
+  std::vector<DetectedObject> all;
+  for (auto const &run : runs) {
+    all.insert(all.end(), run.begin(), run.end());
+  }
+  std::stable_sort(all.begin(), all.end(),
+                   AEBObjectTracker::Comparators::byCollisionTime);
+  std::vector<int> ids;
+  for (auto const &object : all) {
+    ids.push_back(object.getId());
+  }
+  return ids;
+}
+
+} // namespace
+
+TEST(KWayMerger, MergeIsStableAcrossRuns) {
+  const auto runs = makeSortedRuns();
+  const auto ranges = toRanges(runs);
+  KWayMerger merger;
+  std::vector<int> ids;
+  const std::size_t merged = merger.merge(
+      ranges.data(), ranges.size(), 100000U,
+      AEBObjectTracker::Comparators::byCollisionTime,
+      [&ids](DetectedObject const &object) { ids.push_back(object.getId()); });
+
+  EXPECT_EQ(merged, ids.size());
+  EXPECT_EQ(ids, expectedIds(runs));
+}
+
+TEST(KWayMerger, TopKStopsEarly) {
+  const auto runs = makeSortedRuns();
+  const auto ranges = toRanges(runs);
+  KWayMerger merger;
+  std::vector<int> ids;
+  const std::size_t merged = merger.merge(
+      ranges.data(), ranges.size(), 7U,
+      AEBObjectTracker::Comparators::byCollisionTime,
+      [&ids](DetectedObject const &object) { ids.push_back(object.getId()); });
+
+  auto expected = expectedIds(runs);
+  expected.resize(7U);
+  EXPECT_EQ(merged, 7U);
+  EXPECT_EQ(ids, expected);
+}
+
+TEST(KWayMerger, DegenerateInputs) {
+  KWayMerger merger;
+  auto count = [&merger](ObjectRange const *runs, std::size_t run_count) {
+    return merger.merge(runs, run_count, 100U,
+                        AEBObjectTracker::Comparators::byCollisionTime,
+                        [](DetectedObject const &) {});
+  };
+  EXPECT_EQ(count(nullptr, 0U), 0U);
+
+  const std::vector<DetectedObject> single = {DetectedObject(1, 5.0f, -1.0f),
+                                              DetectedObject(2, 9.0f, -1.0f)};
+  const ObjectRange one_run(single.data(), single.size());
+  EXPECT_EQ(count(&one_run, 1U), 2U);
+
+  const ObjectRange empty_runs[3] = {};
+  EXPECT_EQ(count(empty_runs, 3U), 0U);
+}
+
+TEST(AEBObjectTrackerMerge, MergeSortedRunsReplacesObjects) {
+  const auto runs = makeSortedRuns();
+  const auto ranges = toRanges(runs);
+  AEBObjectTracker tracker;
+  tracker.enableIdIndex(true);
+  tracker.addObject(DetectedObject(-1, 1.0f, -1.0f));
+
+  EXPECT_EQ(tracker.mergeSortedRuns(ranges.data(), ranges.size()),
+            expectedIds(runs).size());
+  std::vector<int> ids;
+  for (auto const &object : tracker.getObjects()) {
+    ids.push_back(object.getId());
+  }
+  EXPECT_EQ(ids, expectedIds(runs));
+  EXPECT_EQ(tracker.findObjectById(-1), tracker.getObjects().end());
+  EXPECT_EQ(tracker.findObjectById(1001)->getId(), 1001);
+}
+
+TEST(AEBObjectTrackerMerge, TopKMergeFeedsCriticalObjects) {
+  const auto runs = makeSortedRuns();
+  const auto ranges = toRanges(runs);
+  AEBObjectTracker tracker;
+
+  EXPECT_EQ(tracker.mergeSortedRuns(ranges.data(), ranges.size(), 5U), 5U);
+  const auto critical = tracker.getCriticalObjects(5U);
+  auto expected = expectedIds(runs);
+  ASSERT_EQ(critical.size(), 5U);
+  for (std::size_t i = 0; i < critical.size(); ++i) {
+    EXPECT_EQ(critical[i].getId(), expected[i]) << "Position " << i;
+  }
+}
+
+} // namespace test
+} // namespace object_tracking
+} // namespace aeb
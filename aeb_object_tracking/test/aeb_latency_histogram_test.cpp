@@ -0,0 +1,79 @@
+/// @file aeb_latency_histogram_test.cpp
+
+#include "../include/aeb_latency_histogram.h"
+#include "gtest/gtest.h"  // for AssertionResult, Test, Message, TestPartResult
+#include <cstdint>        // for uint64_t
+
+namespace aeb {
+namespace object_tracking {
+namespace test {
+
+TEST(LatencyHistogram, EmptyHistogramReportsZero) {
+  const LatencyHistogram histogram;
+  EXPECT_EQ(histogram.count(), 0U);
+  EXPECT_EQ(histogram.valueAtQuantile(0.99), 0U);
+  EXPECT_EQ(histogram.min(), 0U);
+  EXPECT_EQ(histogram.max(), 0U);
+}
+
+TEST(LatencyHistogram, SmallValuesAreExact) {
+  LatencyHistogram histogram;
+  for (std::uint64_t value = 1U; value <= 100U; ++value) {
+    histogram.record(value);
+  }
+  EXPECT_EQ(histogram.valueAtQuantile(0.5), 50U);
+  EXPECT_EQ(histogram.valueAtQuantile(0.99), 99U);
+  EXPECT_EQ(histogram.valueAtQuantile(1.0), 100U);
+  EXPECT_EQ(histogram.min(), 1U);
+  EXPECT_DOUBLE_EQ(histogram.mean(), 50.5);
+}
+
+TEST(LatencyHistogram, LargeValuesWithinRelativePrecision) {
+  LatencyHistogram histogram;
+  // 1000 samples: 1..999 microseconds, plus one 50 ms outlier.
+  for (std::uint64_t us = 1U; us < 1000U; ++us) {
+    histogram.record(us * 1000U);
+  }
+  histogram.record(50000000U);
+
+  const auto p50 = static_cast<double>(histogram.valueAtQuantile(0.5));
+  const auto p99 = static_cast<double>(histogram.valueAtQuantile(0.99));
+  EXPECT_NEAR(p50, 500000.0, 500000.0 / 128.0);
+  EXPECT_NEAR(p99, 990000.0, 990000.0 / 128.0);
+  EXPECT_EQ(histogram.valueAtQuantile(0.9999), 50000000U)
+      << "The top quantile is clamped to the exact maximum.";
+  EXPECT_EQ(histogram.max(), 50000000U);
+}
+
+TEST(LatencyHistogram, MergeAndReset) {
+  LatencyHistogram first;
+  LatencyHistogram second;
+  first.record(10U);
+  second.record(1000000U);
+  second.record(5U);
+
+  first.merge(second);
+  EXPECT_EQ(first.count(), 3U);
+  EXPECT_EQ(first.min(), 5U);
+  EXPECT_EQ(first.max(), 1000000U);
+
+  first.reset();
+  EXPECT_EQ(first.count(), 0U);
+  EXPECT_EQ(first.valueAtQuantile(0.5), 0U);
+}
+
+TEST(LatencyHistogram, ScopedTimerRecordsOneSample) {
+  LatencyHistogram histogram;
+  { ScopedLatencyTimer timer(histogram); }
+  EXPECT_EQ(histogram.count(), 1U);
+
+  {
+    AEB_LATENCY_SCOPE(histogram);
+  }
+  EXPECT_EQ(histogram.count(), kLatencyInstrumentationEnabled ? 2U : 1U)
+      << "AEB_LATENCY_SCOPE records only when instrumentation is enabled.";
+}
+
+} // namespace test
+} // namespace object_tracking
+} // namespace aeb
@@ -0,0 +1,89 @@
+/// @file aeb_memory_resource_test.cpp
+
+#include "../include/aeb_memory_resource.h"
+#include "../include/aeb_tracker.h"
+#include "gtest/gtest.h"  // for AssertionResult, Test, Message, TestPartResult
+#include <cstdint>        // for uintptr_t
+#include <new>            // for bad_alloc
+
+namespace aeb {
+namespace object_tracking {
+namespace test {
+
+TEST(FixedArenaResource, BumpsAlignsAndThrowsWhenFull) {
+  FixedArenaResource arena(256U);
+
+  void *first = arena.allocate(3U, 1U);
+  void *second = arena.allocate(8U, 8U);
+  EXPECT_EQ(reinterpret_cast<std::uintptr_t>(second) % 8U, 0U);
+  EXPECT_NE(first, second);
+  EXPECT_GE(arena.used(), 11U);
+
+  EXPECT_THROW(static_cast<void>(arena.allocate(512U, 8U)), std::bad_alloc)
+      << "An exhausted arena must not fall back to the heap.";
+
+  arena.release();
+  EXPECT_EQ(arena.used(), 0U);
+  EXPECT_EQ(arena.allocate(3U, 1U), first);
+}
+
+TEST(AllocationGuardResource, CountsFrozenAllocations) {
+  AllocationGuardResource guard(std::pmr::get_default_resource(), false);
+  std::pmr::vector<int> values(&guard);
+  values.reserve(4U);
+  EXPECT_EQ(guard.allocationCount(), 1U);
+
+  {
+    SteadyStateScope steady_state(guard);
+    values.push_back(1);
+    EXPECT_EQ(guard.violationCount(), 0U);
+    values.reserve(64U);
+    EXPECT_EQ(guard.violationCount(), 1U);
+  }
+  EXPECT_FALSE(guard.isFrozen());
+}
+
+TEST(AEBObjectTrackerMemoryResource, SteadyStateCycleDoesNotAllocate) {
+  constexpr std::size_t kCapacity = 512U;
+  FixedArenaResource arena(256U * 1024U);
+  AllocationGuardResource guard(&arena);
+
+  AEBObjectTracker tracker(&guard);
+  EXPECT_EQ(tracker.getMemoryResource(), &guard);
+  tracker.setSortMode(AEBObjectTracker::SortMode::kRadixKey);
+  tracker.enableIdIndex(true);
+  tracker.setIncrementalCriticalObjects(5U);
+  tracker.reserveCapacity(kCapacity);
+  const std::size_t init_bytes = arena.used();
+
+  FixedArenaResource frame_arena(4096U);
+  for (int frame = 0; frame < 10; ++frame) {
+    SteadyStateScope steady_state(guard);
+    tracker.clear();
+    for (int id = 0; id < static_cast<int>(kCapacity); ++id) {
+      const float distance =
+          5.0f + static_cast<float>((id * 37 + frame) % 200);
+      tracker.addObject(DetectedObject(id, distance, -10.0f));
+    }
+    tracker.partialSortCriticalObjects(5U);
+    tracker.sortByCollisionTime();
+    tracker.sortMultiCriteria();
+    EXPECT_NE(tracker.findObjectById(7), tracker.getObjects().end());
+    EXPECT_EQ(tracker.getCriticalObjectsView(5U).size(), 5U);
+
+    const auto critical = tracker.getCriticalObjects(5U, &frame_arena);
+    const auto within = tracker.getObjectsWithinTimeThreshold(1.0f,
+                                                              &frame_arena);
+    EXPECT_EQ(critical.size(), 5U);
+    EXPECT_FALSE(within.empty());
+    frame_arena.release();
+  }
+
+  EXPECT_EQ(guard.violationCount(), 0U);
+  EXPECT_EQ(arena.used(), init_bytes)
+      << "All tracker storage must be sized by reserveCapacity().";
+}
+
+} // namespace test
+} // namespace object_tracking
+} // namespace aeb
@@ -0,0 +1,81 @@
+/// @file aeb_object_id_index_test.cpp
+
+#include "../include/aeb_object_id_index.h"
+#include "../include/aeb_tracker.h"
+#include "gtest/gtest.h"  // for AssertionResult, Test, Message, TestPartResult
+#include <vector>         // for vector
+
+namespace aeb {
+namespace object_tracking {
+namespace test {
+
+TEST(ObjectIdIndex, InsertFindAndGrow) {
+  ObjectIdIndex index;
+  EXPECT_EQ(index.find(1), ObjectIdIndex::kNotFound);
+
+  for (int id = -500; id < 500; ++id) {
+    EXPECT_TRUE(index.insert(id * 7, static_cast<std::size_t>(id + 500)));
+  }
+  EXPECT_EQ(index.size(), 1000U);
+  for (int id = -500; id < 500; ++id) {
+    EXPECT_EQ(index.find(id * 7), static_cast<std::size_t>(id + 500));
+  }
+  EXPECT_EQ(index.find(3), ObjectIdIndex::kNotFound);
+}
+
+TEST(ObjectIdIndex, FirstPositionOfDuplicateWins) {
+  ObjectIdIndex index;
+  EXPECT_TRUE(index.insert(42, 3U));
+  EXPECT_FALSE(index.insert(42, 9U));
+  EXPECT_EQ(index.find(42), 3U);
+
+  index.clear();
+  EXPECT_EQ(index.find(42), ObjectIdIndex::kNotFound);
+  EXPECT_EQ(index.size(), 0U);
+}
+
+TEST(AEBObjectTrackerIdIndex, LookupsFollowSortsAndClear) {
+  AEBObjectTracker tracker;
+  tracker.enableIdIndex(true);
+  for (int id = 0; id < 100; ++id) {
+    tracker.addObject(DetectedObject(id, 10.0f + static_cast<float>(id % 17),
+                                     -1.0f - static_cast<float>(id % 13)));
+  }
+
+  tracker.sortByCollisionTime();
+  for (int id = 0; id < 100; ++id) {
+    const auto found = tracker.findObjectById(id);
+    ASSERT_NE(found, tracker.getObjects().end());
+    EXPECT_EQ(found->getId(), id)
+        << "The index must be rebuilt after the objects are reordered.";
+  }
+
+  tracker.partialSortCriticalObjects(5);
+  std::vector<std::size_t> positions;
+  tracker.findObjectsByIds({99, 1000, 0}, positions);
+  ASSERT_EQ(positions.size(), 3U);
+  EXPECT_EQ(tracker.getObjects()[positions[0]].getId(), 99);
+  EXPECT_EQ(positions[1], ObjectIdIndex::kNotFound);
+  EXPECT_EQ(tracker.getObjects()[positions[2]].getId(), 0);
+
+  tracker.clear();
+  EXPECT_EQ(tracker.findObjectById(5), tracker.getObjects().end());
+}
+
+TEST(AEBObjectTrackerIdIndex, EnablingIndexesExistingObjects) {
+  AEBObjectTracker tracker;
+  tracker.addObject(DetectedObject(7, 20.0f, -5.0f));
+  tracker.addObject(DetectedObject(8, 30.0f, -5.0f));
+
+  tracker.enableIdIndex(true);
+  EXPECT_TRUE(tracker.isIdIndexEnabled());
+  EXPECT_EQ(tracker.findObjectById(8)->getDistance(), 30.0f);
+
+  tracker.enableIdIndex(false);
+  EXPECT_EQ(tracker.findObjectById(8)->getDistance(), 30.0f)
+      << "Without the index the linear search is used.";
+}
+
+} // namespace test
+} // namespace object_tracking
+} // namespace aeb
@@ -0,0 +1,125 @@
+/// @file aeb_object_staging_test.cpp
+
+#include "../include/aeb_object_staging.h"
+#include "../include/aeb_tracker.h"
+#include "gtest/gtest.h"  // for AssertionResult, Test, Message, TestPartResult
+#include <algorithm>      // for sort
+#include <cstddef>        // for size_t
+#include <thread>         // for thread
+#include <vector>         // for vector
+
+namespace aeb {
+namespace object_tracking {
+namespace test {
+
+namespace {
+
+/// Deterministic pseudo-random object for producer p.
+DetectedObject sensorObject(std::size_t producer, int i) {
+  const int seed = static_cast<int>(producer) * 977 + i;
+  const float distance = 1.0f + static_cast<float>(seed * 7919 % 1999) * 0.05f;
+  const float velocity = -20.0f + static_cast<float>(seed * 31 % 41);
+  return DetectedObject(static_cast<int>(producer) * 1000000 + i, distance,
+                        velocity);
+}
+
+void expectSameCollisionTimeOrder(AEBObjectTracker const &actual,
+                                  AEBObjectTracker const &expected) {
+  ASSERT_EQ(actual.size(), expected.size());
+  for (std::size_t i = 0; i < actual.size(); ++i) {
+    EXPECT_EQ(actual.getObjects()[i].getCollisionTime(),
+              expected.getObjects()[i].getCollisionTime())
+        << "Position " << i;
+  }
+  // Equal finite TTCs are unordered, so compare the objects as sets.
+  std::vector<int> actual_ids;
+  std::vector<int> expected_ids;
+  for (std::size_t i = 0; i < actual.size(); ++i) {
+    actual_ids.push_back(actual.getObjects()[i].getId());
+    expected_ids.push_back(expected.getObjects()[i].getId());
+  }
+  std::sort(actual_ids.begin(), actual_ids.end());
+  std::sort(expected_ids.begin(), expected_ids.end());
+  EXPECT_EQ(actual_ids, expected_ids);
+}
+
+} // namespace
+
+TEST(ObjectStaging, CommitAsStagedConcatenatesRuns) {
+  ObjectStaging staging(3U);
+  staging.addObject(2U, DetectedObject(3, 10.0f, -1.0f));
+  staging.addObject(0U, DetectedObject(1, 20.0f, -1.0f));
+  staging.addObject(1U, DetectedObject(2, 30.0f, -1.0f));
+  EXPECT_EQ(staging.stagedCount(), 3U);
+  EXPECT_FALSE(staging.isRunSorted(0U));
+
+  AEBObjectTracker tracker;
+  tracker.enableIdIndex(true);
+  tracker.setIncrementalCriticalObjects(1U);
+  EXPECT_EQ(tracker.commitFrame(staging), 3U);
+
+  EXPECT_EQ(tracker.getObjects()[0].getId(), 1);
+  EXPECT_EQ(tracker.getObjects()[1].getId(), 2);
+  EXPECT_EQ(tracker.getObjects()[2].getId(), 3);
+  EXPECT_EQ(tracker.findObjectById(3)->getDistance(), 10.0f);
+  EXPECT_EQ(tracker.getCriticalObjectsView(1U)[0].getId(), 3)
+      << "The critical set is rebuilt from the committed frame.";
+  EXPECT_EQ(staging.stagedCount(), 0U) << "Committing clears the staging.";
+}
+
+TEST(ObjectStaging, CommitByCollisionTimeMatchesFullSort) {
+  ObjectStaging staging(3U);
+  AEBObjectTracker reference;
+  for (std::size_t p = 0; p < staging.producerCount(); ++p) {
+    for (int i = 0; i < 500 + static_cast<int>(p) * 100; ++i) {
+      staging.addObject(p, sensorObject(p, i));
+      reference.addObject(sensorObject(p, i));
+    }
+  }
+  staging.sortRun(1U); // A producer may pre-sort its own run.
+  EXPECT_TRUE(staging.isRunSorted(1U));
+  reference.sortByCollisionTime();
+
+  AEBObjectTracker tracker;
+  tracker.commitFrame(staging, AEBObjectTracker::CommitOrder::kCollisionTime);
+
+  expectSameCollisionTimeOrder(tracker, reference);
+}
+
+TEST(ObjectStaging, ConcurrentProducersLargeFrame) {
+  constexpr std::size_t kProducers = 3U;
+  constexpr int kObjectsPerProducer = 20000; // Large enough to sort in
+                                             // parallel on commit.
+  ObjectStaging staging(kProducers);
+  staging.reserve(kObjectsPerProducer);
+
+  std::vector<std::thread> producers;
+  for (std::size_t p = 0; p < kProducers; ++p) {
+    producers.emplace_back([&staging, p] {
+      for (int i = 0; i < kObjectsPerProducer; ++i) {
+        staging.addObject(p, sensorObject(p, i));
+      }
+    });
+  }
+  for (auto &producer : producers) {
+    producer.join();
+  }
+
+  AEBObjectTracker reference;
+  for (std::size_t p = 0; p < kProducers; ++p) {
+    for (int i = 0; i < kObjectsPerProducer; ++i) {
+      reference.addObject(sensorObject(p, i));
+    }
+  }
+  reference.sortByCollisionTime();
+
+  AEBObjectTracker tracker;
+  tracker.reserveCapacity(kProducers * kObjectsPerProducer);
+  tracker.commitFrame(staging, AEBObjectTracker::CommitOrder::kCollisionTime);
+
+  expectSameCollisionTimeOrder(tracker, reference);
+}
+
+} // namespace test
+} // namespace object_tracking
+} // namespace aeb
@@ -0,0 +1,189 @@
+/// @file aeb_parallel_sort_test.cpp
+
+#include "../include/aeb_parallel_sort.h"
+#include "../include/aeb_tracker.h"
+#include "gtest/gtest.h"  // for AssertionResult, Test, Message, TestPartResult
+#include <algorithm>      // for stable_sort
+#include <cstddef>        // for size_t, ptrdiff_t
+#include <vector>         // for vector
+
+namespace aeb {
+namespace object_tracking {
+namespace test {
+
+namespace {
+
+/// Frame with many exact ties so that stability is observable.
+void fillTracker(AEBObjectTracker &tracker, int count) {
+  tracker.reserveCapacity(static_cast<std::size_t>(count));
+  for (int id = 0; id < count; ++id) {
+    const float distance = 5.0f + static_cast<float>(id * 7919 % 997) * 0.1f;
+    const float velocity =
+        (id % 11 == 0) ? 1.0f : -1.0f - static_cast<float>(id % 5);
+    tracker.addObject(DetectedObject(id, distance, velocity));
+  }
+}
+
+} // namespace
+
+TEST(ParallelSort, StableSortMatchesSerialForAnyThreadCount) {
+  std::vector<int> reference(100000);
+  for (std::size_t i = 0; i < reference.size(); ++i) {
+    reference[i] = static_cast<int>(i * 2654435761U % 1000U);
+  }
+  auto by_bucket = [](int a, int b) { return a / 10 < b / 10; };
+  auto expected = reference;
+  std::stable_sort(expected.begin(), expected.end(), by_bucket);
+
+  for (unsigned threads : {1U, 2U, 3U, 8U}) {
+    auto values = reference;
+    parallelStableSort(values.begin(), values.end(), by_bucket,
+                       ParallelSortOptions{1000U, threads});
+    EXPECT_EQ(values, expected) << "Threads " << threads;
+  }
+}
+
+TEST(ParallelSort, PartialSortIsIndependentOfThreadCount) {
+  std::vector<int> reference(50000);
+  for (std::size_t i = 0; i < reference.size(); ++i) {
+    reference[i] = static_cast<int>(i * 40503U % 5000U);
+  }
+  auto by_bucket = [](int a, int b) { return a / 10 < b / 10; };
+  auto expected = reference;
+  std::stable_sort(expected.begin(), expected.end(), by_bucket);
+
+  for (unsigned threads : {1U, 4U, 7U}) {
+    auto values = reference;
+    parallelPartialSort(values.begin(), values.begin() + 25, values.end(),
+                        by_bucket, ParallelSortOptions{1000U, threads});
+    for (std::size_t i = 0; i < 25U; ++i) {
+      EXPECT_EQ(values[i], expected[i]) << "Threads " << threads;
+    }
+    auto rest = values;
+    std::stable_sort(rest.begin(), rest.end(), by_bucket);
+    EXPECT_EQ(rest, expected) << "No element may be lost or duplicated.";
+  }
+}
+
+TEST(ParallelSort, InPlaceSelectionMatchesChunkedPath) {
+  std::vector<int> reference(20000);
+  for (std::size_t i = 0; i < reference.size(); ++i) {
+    reference[i] = static_cast<int>(i * 40503U % 5000U);
+  }
+  auto by_bucket = [](int a, int b) { return a / 10 < b / 10; };
+
+  for (std::ptrdiff_t k : {1, 5, 8}) {
+    auto chunked = reference;
+    parallelPartialSort(chunked.begin(), chunked.begin() + k, chunked.end(),
+                        by_bucket, ParallelSortOptions{1000U, 4U});
+    auto in_place = reference;
+    parallelPartialSort(in_place.begin(), in_place.begin() + k,
+                        in_place.end(), by_bucket,
+                        ParallelSortOptions{1000000U, 1U});
+    EXPECT_EQ(in_place, chunked)
+        << "K " << k << ": prefix and remainder order must not depend on "
+        << "the path taken.";
+  }
+}
+
+TEST(AEBObjectTrackerParallelSort, LargeFrameMatchesSerialPath) {
+  AEBObjectTracker parallel;
+  AEBObjectTracker serial;
+  fillTracker(parallel, 40000);
+  fillTracker(serial, 40000);
+  parallel.enableIdIndex(true);
+
+  parallel.sortByCollisionTime(ParallelSortOptions{1000U, 4U});
+  serial.sortByCollisionTime(ParallelSortOptions{1000000U, 1U});
+
+  ASSERT_EQ(parallel.size(), serial.size());
+  for (std::size_t i = 0; i < serial.size(); ++i) {
+    ASSERT_EQ(parallel.getObjects()[i].getId(), serial.getObjects()[i].getId())
+        << "Position " << i;
+  }
+  EXPECT_EQ(parallel.findObjectById(123)->getId(), 123)
+      << "The ID index must follow the parallel sort.";
+}
+
+TEST(AEBObjectTrackerParallelSort, PartialSortMatchesSerialPath) {
+  AEBObjectTracker parallel;
+  AEBObjectTracker serial;
+  fillTracker(parallel, 30000);
+  fillTracker(serial, 30000);
+
+  parallel.partialSortCriticalObjects(5, ParallelSortOptions{1000U, 3U});
+  serial.partialSortCriticalObjects(5, ParallelSortOptions{1000000U, 1U});
+
+  const auto expected = serial.getCriticalObjects(5);
+  const auto critical = parallel.getCriticalObjects(5);
+  ASSERT_EQ(critical.size(), 5U);
+  for (std::size_t i = 0; i < critical.size(); ++i) {
+    EXPECT_EQ(critical[i].getId(), expected[i].getId());
+  }
+}
+
+TEST(AEBObjectTrackerParallelSort, ThreatAndMultiCriteriaMatchSerialPath) {
+  // Spread-out frame with many near-equal threat levels and TTCs, where the
+  // epsilon comparators are not transitive.
+  auto fill_random = [](AEBObjectTracker &tracker) {
+    for (int id = 0; id < 40000; ++id) {
+      const auto hash = static_cast<unsigned>(id) * 2654435761U;
+      const float distance = 1.0f + static_cast<float>(hash % 99991U) * 1e-3f;
+      const float velocity =
+          -0.5f - static_cast<float>((hash >> 8U) % 3001U) * 0.01f;
+      tracker.addObject(DetectedObject(id, distance, velocity));
+    }
+  };
+  using SortCall = void (AEBObjectTracker::*)(ParallelSortOptions const &);
+  for (const SortCall sort : {SortCall{&AEBObjectTracker::sortByThreatLevel},
+                              SortCall{&AEBObjectTracker::sortMultiCriteria}}) {
+    AEBObjectTracker serial;
+    fill_random(serial);
+    (serial.*sort)(ParallelSortOptions{1000000U, 1U});
+    for (unsigned threads : {2U, 4U, 7U}) {
+      AEBObjectTracker parallel;
+      fill_random(parallel);
+      (parallel.*sort)(ParallelSortOptions{1000U, threads});
+      std::size_t differing = 0U;
+      for (std::size_t i = 0; i < serial.size(); ++i) {
+        differing += (parallel.getObjects()[i].getId() !=
+                      serial.getObjects()[i].getId())
+                         ? 1U
+                         : 0U;
+      }
+      EXPECT_EQ(differing, 0U) << "Threads " << threads;
+    }
+  }
+
+  // The parallel multi-criteria order is the radix key order.
+  AEBObjectTracker radix;
+  AEBObjectTracker parallel;
+  fill_random(radix);
+  fill_random(parallel);
+  radix.setSortMode(AEBObjectTracker::SortMode::kRadixKey);
+  radix.sortMultiCriteria();
+  parallel.sortMultiCriteria(ParallelSortOptions{1000U, 4U});
+  for (std::size_t i = 0; i < radix.size(); ++i) {
+    ASSERT_EQ(parallel.getObjects()[i].getId(), radix.getObjects()[i].getId())
+        << "Position " << i;
+  }
+}
+
+TEST(AEBObjectTrackerParallelSort, SortByThreatLevelOrdersByThreat) {
+  AEBObjectTracker tracker;
+  tracker.addObject(DetectedObject(1, 80.0f, -1.0f)); // low threat
+  tracker.addObject(DetectedObject(2, 10.0f, -10.0f)); // high threat
+  tracker.addObject(DetectedObject(3, 30.0f, -10.0f)); // medium threat
+
+  tracker.sortByThreatLevel();
+  EXPECT_EQ(tracker.getObjects()[0].getId(), 2);
+  EXPECT_EQ(tracker.getObjects()[1].getId(), 3);
+  EXPECT_EQ(tracker.getObjects()[2].getId(), 1);
+
+  tracker.sortByThreatLevel(ParallelSortOptions{});
+  EXPECT_EQ(tracker.getObjects()[0].getId(), 2);
+}
+
+} // namespace test
+} // namespace object_tracking
+} // namespace aeb
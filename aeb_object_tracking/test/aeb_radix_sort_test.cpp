@@ -0,0 +1,130 @@
+/// @file aeb_radix_sort_test.cpp
+
+#include "../include/aeb_radix_sort.h"
+#include "../include/aeb_tracker.h"
+#include "gtest/gtest.h"  // for AssertionResult, Test, Message, TestPartResult
+#include <cstdint>        // for uint64_t
+#include <limits>         // for numeric_limits
+#include <memory_resource> // for pmr::vector
+#include <vector>         // for vector
+
+namespace aeb {
+namespace object_tracking {
+namespace test {
+
+TEST(RadixSort, OrderedFloatBitsKeepOrder) {
+  const std::vector<float> ascending = {
+      -std::numeric_limits<float>::max(), -10.0f, -1.0f, -1e-30f, 0.0f,
+      1e-30f, 0.5f, 1.0f, 100.0f, std::numeric_limits<float>::max()};
+  for (std::size_t i = 1; i < ascending.size(); ++i) {
+    EXPECT_LT(orderedFloatBits(ascending[i - 1]), orderedFloatBits(ascending[i]))
+        << ascending[i - 1] << " vs " << ascending[i];
+  }
+  EXPECT_EQ(orderedFloatBits(-0.0f), orderedFloatBits(0.0f));
+}
+
+TEST(RadixSort, KeyAgreesWithComparator) {
+  const std::vector<DetectedObject> objects = {
+      DetectedObject(1, 9.0f, 0.0f),    DetectedObject(2, 5.0f, -3.5f),
+      DetectedObject(3, 12.0f, 0.0f),   DetectedObject(4, 50.0f, -5.0f),
+      DetectedObject(5, 0.0f, -1.0f),   DetectedObject(6, 100.0f, 3.0f),
+      DetectedObject(7, 2.0f, -100.0f), DetectedObject(8, 1000.0f, -0.5f)};
+  auto key = [](DetectedObject const &object) {
+    return collisionTimeSortKey(object.getCollisionTime(),
+                                object.getDistance());
+  };
+  for (auto const &a : objects) {
+    for (auto const &b : objects) {
+      if (AEBObjectTracker::Comparators::byCollisionTime(a, b)) {
+        EXPECT_LT(key(a), key(b)) << "IDs " << a.getId() << ", " << b.getId();
+      }
+    }
+  }
+}
+
+TEST(RadixSort, MultiCriteriaKeyPriorities) {
+  // Threat level dominates TTC, TTC dominates distance.
+  EXPECT_LT(multiCriteriaSortKey(0.9f, 5.0f, 80.0f),
+            multiCriteriaSortKey(0.5f, 1.0f, 10.0f));
+  EXPECT_LT(multiCriteriaSortKey(0.5f, 1.0f, 80.0f),
+            multiCriteriaSortKey(0.5f, 2.0f, 10.0f));
+  EXPECT_LT(multiCriteriaSortKey(0.5f, 1.0f, 10.0f),
+            multiCriteriaSortKey(0.5f, 1.0f, 80.0f));
+  // Differences below the bucket width fall through to distance.
+  EXPECT_LT(multiCriteriaSortKey(0.5f, 1.02f, 10.0f),
+            multiCriteriaSortKey(0.5f, 1.01f, 80.0f));
+  EXPECT_LT(multiCriteriaSortKey(0.0f, 1000.0f, 10.0f),
+            multiCriteriaSortKey(0.0f, std::numeric_limits<float>::infinity(),
+                                 1.0f));
+}
+
+TEST(RadixSort, SorterIsStable) {
+  const std::vector<std::uint64_t> keys = {5U, 1U, 5U, 0xFFFFFFFF00000000U, 1U,
+                                           0U};
+  RadixKeySorter sorter;
+  const auto &order = sorter.sort(keys.data(), keys.size());
+  const std::pmr::vector<std::uint32_t> expected = {5U, 1U, 4U, 0U, 2U, 3U};
+  EXPECT_EQ(order, expected);
+  EXPECT_TRUE(sorter.sort(keys.data(), 0U).empty());
+}
+
+TEST(AEBObjectTrackerRadixSort, MatchesComparisonSort) {
+  AEBObjectTracker radix;
+  AEBObjectTracker reference;
+  radix.setSortMode(AEBObjectTracker::SortMode::kRadixKey);
+  radix.enableIdIndex(true);
+  for (int id = 0; id < 5000; ++id) {
+    const float distance = 1.0f + static_cast<float>(id * 7919 % 4999) * 0.05f;
+    const float velocity = -25.0f + static_cast<float>(id * 31 % 53);
+    radix.addObject(DetectedObject(id, distance, velocity));
+    reference.addObject(DetectedObject(id, distance, velocity));
+  }
+
+  radix.sortByCollisionTime();
+  reference.sortByCollisionTime();
+
+  const auto &sorted = radix.getObjects();
+  ASSERT_EQ(sorted.size(), reference.size());
+  for (std::size_t i = 0; i < sorted.size(); ++i) {
+    EXPECT_EQ(sorted[i].getCollisionTime(),
+              reference.getObjects()[i].getCollisionTime());
+    if (i > 0U) {
+      EXPECT_FALSE(AEBObjectTracker::Comparators::byCollisionTime(
+          sorted[i], sorted[i - 1U]))
+          << "Order broken at position " << i;
+    }
+  }
+  EXPECT_EQ(radix.findObjectById(42)->getId(), 42);
+}
+
+TEST(AEBObjectTrackerRadixSort, MultiCriteriaFollowsPackedKey) {
+  AEBObjectTracker tracker;
+  tracker.setSortMode(AEBObjectTracker::SortMode::kRadixKey);
+  for (int id = 0; id < 2000; ++id) {
+    const float distance = 1.0f + static_cast<float>(id * 7919 % 1999) * 0.05f;
+    const float velocity = -20.0f + static_cast<float>(id * 31 % 41);
+    tracker.addObject(DetectedObject(id, distance, velocity));
+  }
+
+  tracker.sortMultiCriteria();
+
+  const auto &sorted = tracker.getObjects();
+  for (std::size_t i = 1; i < sorted.size(); ++i) {
+    auto const &previous = sorted[i - 1U];
+    auto const &current = sorted[i];
+    EXPECT_LE(multiCriteriaSortKey(previous.getThreatLevel(),
+                                   previous.getCollisionTime(),
+                                   previous.getDistance()),
+              multiCriteriaSortKey(current.getThreatLevel(),
+                                   current.getCollisionTime(),
+                                   current.getDistance()))
+        << "Order broken at position " << i;
+    EXPECT_FALSE(current.getThreatLevel() >
+                 previous.getThreatLevel() + 0.01f)
+        << "Threat levels further apart than the epsilon keep their order.";
+  }
+}
+
+} // namespace test
+} // namespace object_tracking
+} // namespace aeb
@@ -0,0 +1,159 @@
+/// @file aeb_scenario_generator_test.cpp
+
+#include "../include/aeb_scenario_generator.h"
+#include "../include/aeb_tracker.h"
+#include "gtest/gtest.h"  // for AssertionResult, Test, Message, TestPartResult
+#include <cmath>          // for isinf, abs
+#include <cstddef>        // for size_t
+#include <vector>         // for vector
+
+namespace aeb {
+namespace object_tracking {
+namespace test {
+
+namespace {
+
+constexpr ScenarioType kAllScenarios[] = {
+    ScenarioType::kHighwayPlatoon, ScenarioType::kUrbanClutter,
+    ScenarioType::kCutIn, ScenarioType::kStationaryClutter,
+    ScenarioType::kMixed};
+
+std::size_t countWithin(ObjectRange frame, float threshold_seconds) {
+  std::size_t count = 0U;
+  for (auto const &object : frame) {
+    if (!std::isinf(object.getCollisionTime()) &&
+        object.getCollisionTime() <= threshold_seconds) {
+      ++count;
+    }
+  }
+  return count;
+}
+
+} // namespace
+
+TEST(ScenarioGenerator, SameSeedSameFrames) {
+  ScenarioConfig config;
+  config.object_count = 500U;
+  ScenarioGenerator first(config);
+  ScenarioGenerator second(config);
+  config.seed += 1U;
+  ScenarioGenerator other_seed(config);
+
+  for (int frame = 0; frame < 5; ++frame) {
+    const ObjectRange a = first.nextFrame();
+    const ObjectRange b = second.nextFrame();
+    ASSERT_EQ(a.size(), 500U);
+    ASSERT_EQ(b.size(), 500U);
+    for (std::size_t i = 0; i < a.size(); ++i) {
+      EXPECT_EQ(a[i].getId(), b[i].getId());
+      EXPECT_EQ(a[i].getDistance(), b[i].getDistance())
+          << "Frame " << frame << ", object " << i;
+      EXPECT_EQ(a[i].getRelativeVelocity(), b[i].getRelativeVelocity())
+          << "Frame " << frame << ", object " << i;
+    }
+  }
+  second.nextFrame();
+  EXPECT_NE(other_seed.nextFrame()[0].getDistance(),
+            ScenarioGenerator(ScenarioConfig{}).nextFrame()[0].getDistance());
+  EXPECT_EQ(second.frameCount(), 6U);
+}
+
+TEST(ScenarioGenerator, TracksAreTemporallyCoherent) {
+  for (const ScenarioType type : kAllScenarios) {
+    ScenarioConfig config;
+    config.type = type;
+    config.object_count = 200U;
+    ScenarioGenerator generator(config);
+    const ObjectRange first = generator.nextFrame();
+    const std::vector<DetectedObject> previous(first.begin(), first.end());
+    const ObjectRange next = generator.nextFrame();
+
+    std::size_t persisted = 0U;
+    for (std::size_t i = 0; i < next.size(); ++i) {
+      if (next[i].getId() != previous[i].getId()) {
+        continue; // Respawned track
+      }
+      ++persisted;
+      const float expected_distance =
+          previous[i].getDistance() +
+          previous[i].getRelativeVelocity() * config.frame_period_s;
+      EXPECT_NEAR(next[i].getDistance(), expected_distance, 1e-4f)
+          << toString(type) << " track " << next[i].getId();
+      EXPECT_NEAR(next[i].getRelativeVelocity(),
+                  previous[i].getRelativeVelocity(), 0.31f)
+          << toString(type) << " track " << next[i].getId();
+    }
+    EXPECT_GT(persisted, 190U) << toString(type);
+  }
+}
+
+TEST(ScenarioGenerator, ScenariosHaveDistinctTtcProfiles) {
+  auto frameOf = [](ScenarioType type, std::vector<DetectedObject> &out) {
+    ScenarioConfig config;
+    config.type = type;
+    config.object_count = 1000U;
+    ScenarioGenerator generator(config);
+    const ObjectRange frame = generator.nextFrame();
+    out.assign(frame.begin(), frame.end());
+    return ObjectRange(out.data(), out.size());
+  };
+  std::vector<DetectedObject> storage;
+
+  const ObjectRange stationary =
+      frameOf(ScenarioType::kStationaryClutter, storage);
+  for (auto const &object : stationary) {
+    EXPECT_TRUE(std::isinf(object.getCollisionTime()));
+  }
+
+  const std::size_t urban_critical =
+      countWithin(frameOf(ScenarioType::kUrbanClutter, storage), 2.0f);
+  const std::size_t highway_critical =
+      countWithin(frameOf(ScenarioType::kHighwayPlatoon, storage), 2.0f);
+  const std::size_t cut_in_critical =
+      countWithin(frameOf(ScenarioType::kCutIn, storage), 2.0f);
+  EXPECT_GT(urban_critical, 100U) << "Pedestrians close ahead";
+  EXPECT_GT(cut_in_critical, highway_critical) << "Cut-ins add close threats";
+}
+
+TEST(ScenarioGenerator, ScalesToOneMillionObjects) {
+  ScenarioConfig config;
+  config.object_count = 1000000U;
+  ScenarioGenerator generator(config);
+  EXPECT_EQ(generator.nextFrame().size(), 1000000U);
+
+  config.object_count = 10U;
+  ScenarioGenerator small(config);
+  EXPECT_EQ(small.nextFrame().size(), 10U);
+}
+
+TEST(ScenarioGenerator, RadixSortMatchesComparisonSortOnScenarios) {
+  for (const ScenarioType type : kAllScenarios) {
+    ScenarioConfig config;
+    config.type = type;
+    config.object_count = 3000U;
+    ScenarioGenerator generator(config);
+    AEBObjectTracker radix;
+    AEBObjectTracker reference;
+    radix.setSortMode(AEBObjectTracker::SortMode::kRadixKey);
+
+    for (int frame = 0; frame < 3; ++frame) {
+      radix.clear();
+      reference.clear();
+      for (auto const &object : generator.nextFrame()) {
+        radix.addObject(object);
+        reference.addObject(object);
+      }
+      radix.sortByCollisionTime();
+      reference.sortByCollisionTime();
+      for (std::size_t i = 0; i < reference.size(); ++i) {
+        ASSERT_EQ(radix.getObjects()[i].getCollisionTime(),
+                  reference.getObjects()[i].getCollisionTime())
+            << toString(type) << " frame " << frame << ", position " << i;
+      }
+    }
+  }
+}
+
+} // namespace test
+} // namespace object_tracking
+} // namespace aeb
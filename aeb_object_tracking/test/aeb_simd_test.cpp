@@ -0,0 +1,297 @@
+/// @file aeb_simd_test.cpp
+
+#include "../include/aeb_collision_model.h"
+#include "../include/aeb_columnar_tracker.h"
+#include "../include/aeb_simd.h"
+#include "../include/aeb_tracker.h"
+#include "gtest/gtest.h"  // for AssertionResult, Test, Message, TestPartResult
+#include <cmath>          // for isinf
+#include <cstddef>        // for size_t, ptrdiff_t
+#include <limits>         // for numeric_limits
+#include <vector>         // for vector
+
+namespace aeb {
+namespace object_tracking {
+namespace test {
+
+namespace {
+
+/// @brief Distances and velocities covering every TTC/threat band, including
+/// the approaching-velocity boundary and a count that leaves a scalar tail.
+void makeFrame(std::vector<float> &distances, std::vector<float> &velocities) {
+  const float velocity_samples[] = {-30.0f, -20.0f, -12.5f, -5.0f, -1.0f,
+                                    -0.11f, -0.1f,  -0.05f, 0.0f,  7.0f};
+  for (int distance_step = 0; distance_step < 23; ++distance_step) {
+    for (float velocity : velocity_samples) {
+      distances.push_back(0.5f + static_cast<float>(distance_step) * 7.3f);
+      velocities.push_back(velocity);
+    }
+  }
+  distances.push_back(150.0f);
+  velocities.push_back(-3.0f);
+}
+
+/// @brief Accelerations paired with every (distance, velocity) sample,
+/// covering closing, braking, never-reaching and zero acceleration.
+std::vector<float> makeAccelerations(std::size_t count) {
+  const float acceleration_samples[] = {0.0f, -3.0f, 2.5f, 9.0f, -0.0f,
+                                        -8.0f, 0.4f};
+  std::vector<float> accelerations;
+  for (std::size_t i = 0; i < count; ++i) {
+    accelerations.push_back(acceleration_samples[i % 7U]);
+  }
+  return accelerations;
+}
+
+} // namespace
+
+TEST(SimdKernels, BatchMatchesDetectedObject) {
+  std::vector<float> distances;
+  std::vector<float> velocities;
+  makeFrame(distances, velocities);
+
+  std::vector<float> collision_times(distances.size());
+  std::vector<float> threat_levels(distances.size());
+  simd::computeCollisionTimes(distances.data(), velocities.data(),
+                              collision_times.data(), threat_levels.data(),
+                              distances.size());
+
+  for (std::size_t i = 0; i < distances.size(); ++i) {
+    const DetectedObject reference(0, distances[i], velocities[i]);
+    EXPECT_EQ(collision_times[i], reference.getCollisionTime())
+        << "TTC mismatch (" << simd::activeInstructionSet() << ") at " << i;
+    EXPECT_EQ(threat_levels[i], reference.getThreatLevel())
+        << "Threat mismatch (" << simd::activeInstructionSet() << ") at " << i;
+  }
+}
+
+TEST(SimdKernels, ColumnarBatchIngestMatchesAddObject) {
+  std::vector<float> distances;
+  std::vector<float> velocities;
+  makeFrame(distances, velocities);
+  std::vector<int> ids(distances.size());
+  for (std::size_t i = 0; i < ids.size(); ++i) {
+    ids[i] = static_cast<int>(i);
+  }
+
+  ColumnarObjectTracker batch;
+  batch.addObject(DetectedObject(-1, 10.0f, -10.0f));
+  batch.addObjects(ids.data(), distances.data(), velocities.data(),
+                   ids.size());
+
+  ASSERT_EQ(batch.size(), ids.size() + 1U);
+  for (std::size_t i = 0; i < batch.size(); ++i) {
+    const DetectedObject reference = batch.getObject(i);
+    EXPECT_EQ(batch.getCollisionTimes()[i], reference.getCollisionTime());
+    EXPECT_EQ(batch.getThreatLevels()[i], reference.getThreatLevel());
+  }
+}
+
+TEST(SimdKernels, AccelerationTtcKnownValues) {
+  // Standing start: 10 = 5 t^2 / 2 -> t = 2 s.
+  EXPECT_FLOAT_EQ(computeCollisionTime(10.0f, 0.0f, -5.0f), 2.0f);
+  // Receding but pulled back: 10 + 2 t - t^2 = 0 -> t = 1 + sqrt(11).
+  EXPECT_NEAR(computeCollisionTime(10.0f, 2.0f, -2.0f), 4.31662f, 1e-4f);
+  // Braking hard enough to stop 5 m short.
+  EXPECT_TRUE(std::isinf(computeCollisionTime(10.0f, -10.0f, 20.0f)));
+  // Braking but not enough: 10 - 10 t + t^2 = 0 -> t = 5 - sqrt(15).
+  EXPECT_NEAR(computeCollisionTime(10.0f, -10.0f, 2.0f), 1.12702f, 1e-4f);
+
+  std::vector<float> distances;
+  std::vector<float> velocities;
+  makeFrame(distances, velocities);
+  for (std::size_t i = 0; i < distances.size(); ++i) {
+    const float constant_velocity =
+        computeCollisionTime(distances[i], velocities[i]);
+    EXPECT_EQ(computeCollisionTime(distances[i], velocities[i], 0.0f),
+              constant_velocity)
+        << "Zero acceleration must reproduce the constant-velocity model at "
+        << i;
+  }
+}
+
+TEST(SimdKernels, ImpliedAccelerationInvertsCollisionTime) {
+  // Constant velocity and receding objects: exactly no acceleration.
+  EXPECT_EQ(impliedRelativeAcceleration(
+                30.0f, -7.0f, computeCollisionTime(30.0f, -7.0f)),
+            0.0f);
+  EXPECT_EQ(impliedRelativeAcceleration(
+                30.0f, 4.0f, std::numeric_limits<float>::infinity()),
+            0.0f);
+  EXPECT_FLOAT_EQ(impliedRelativeAcceleration(10.0f, 0.0f, 2.0f), -5.0f);
+
+  for (const float acceleration : {-6.0f, -1.5f, 0.75f, 2.0f}) {
+    for (const float velocity : {-12.0f, -3.0f, 0.0f, 1.0f}) {
+      const float collision_time =
+          computeCollisionTime(25.0f, velocity, acceleration);
+      const float implied =
+          impliedRelativeAcceleration(25.0f, velocity, collision_time);
+      if (std::isinf(collision_time)) {
+        EXPECT_TRUE(std::isinf(computeCollisionTime(25.0f, velocity, implied)))
+            << "An object that never arrives must stay so.";
+      } else {
+        EXPECT_NEAR(implied, acceleration, 1e-4f)
+            << "v " << velocity << ", a " << acceleration;
+      }
+    }
+  }
+}
+
+TEST(SimdKernels, AccelerationBatchMatchesDetectedObject) {
+  std::vector<float> distances;
+  std::vector<float> velocities;
+  makeFrame(distances, velocities);
+  const std::vector<float> accelerations = makeAccelerations(distances.size());
+
+  for (const EgoMotion ego : {EgoMotion{}, EgoMotion{12.0f, -1.5f}}) {
+    std::vector<float> relative_velocities(distances.size());
+    std::vector<float> collision_times(distances.size());
+    std::vector<float> threat_levels(distances.size());
+    simd::computeCollisionTimes(distances.data(), velocities.data(),
+                                accelerations.data(), ego,
+                                relative_velocities.data(),
+                                collision_times.data(), threat_levels.data(),
+                                distances.size());
+
+    for (std::size_t i = 0; i < distances.size(); ++i) {
+      const DetectedObject reference(0, distances[i],
+                                     velocities[i] - ego.speed,
+                                     accelerations[i] - ego.acceleration);
+      EXPECT_EQ(relative_velocities[i], reference.getRelativeVelocity());
+      EXPECT_EQ(collision_times[i], reference.getCollisionTime())
+          << "TTC mismatch (" << simd::activeInstructionSet() << ") at " << i;
+      EXPECT_EQ(threat_levels[i], reference.getThreatLevel())
+          << "Threat mismatch (" << simd::activeInstructionSet() << ") at "
+          << i;
+    }
+  }
+}
+
+TEST(SimdKernels, EgoMotionCompensation) {
+  // Lead vehicle at 20 m/s, ego at 30 m/s: closing at 10 m/s.
+  const float distance = 40.0f;
+  const float velocity = 20.0f;
+  const float acceleration = 0.0f;
+  float relative_velocity = 0.0f;
+  float collision_time = 0.0f;
+  float threat_level = 0.0f;
+  simd::computeCollisionTimes(&distance, &velocity, &acceleration,
+                              EgoMotion{30.0f, 0.0f}, &relative_velocity,
+                              &collision_time, &threat_level, 1U);
+  EXPECT_EQ(relative_velocity, -10.0f);
+  EXPECT_EQ(collision_time, 4.0f);
+
+  // Same closing speed, but the ego vehicle brakes at 5 m/s^2: it stops
+  // closing after 2 s and 10 m, well before reaching the lead vehicle.
+  simd::computeCollisionTimes(&distance, &velocity, &acceleration,
+                              EgoMotion{30.0f, -5.0f}, &relative_velocity,
+                              &collision_time, &threat_level, 1U);
+  EXPECT_TRUE(std::isinf(collision_time));
+  EXPECT_EQ(threat_level, 0.0f);
+}
+
+TEST(SimdKernels, AccelerationBatchIngestMatchesAddObject) {
+  std::vector<float> distances;
+  std::vector<float> velocities;
+  makeFrame(distances, velocities);
+  const std::vector<float> accelerations = makeAccelerations(distances.size());
+  std::vector<int> ids(distances.size());
+  for (std::size_t i = 0; i < ids.size(); ++i) {
+    ids[i] = static_cast<int>(i);
+  }
+  const EgoMotion ego{8.0f, 0.5f};
+
+  // More than one ingest chunk.
+  std::vector<int> many_ids;
+  std::vector<float> many_distances;
+  std::vector<float> many_velocities;
+  std::vector<float> many_accelerations;
+  for (int copy = 0; copy < 3; ++copy) {
+    many_ids.insert(many_ids.end(), ids.begin(), ids.end());
+    many_distances.insert(many_distances.end(), distances.begin(),
+                          distances.end());
+    many_velocities.insert(many_velocities.end(), velocities.begin(),
+                           velocities.end());
+    many_accelerations.insert(many_accelerations.end(), accelerations.begin(),
+                              accelerations.end());
+  }
+
+  AEBObjectTracker tracker;
+  tracker.addObjects(many_ids.data(), many_distances.data(),
+                     many_velocities.data(), many_accelerations.data(),
+                     many_ids.size(), ego);
+  ColumnarObjectTracker columnar;
+  columnar.addObjects(many_ids.data(), many_distances.data(),
+                      many_velocities.data(), many_accelerations.data(),
+                      many_ids.size(), ego);
+
+  ASSERT_EQ(tracker.size(), many_ids.size());
+  ASSERT_EQ(columnar.size(), many_ids.size());
+  for (std::size_t i = 0; i < many_ids.size(); ++i) {
+    const DetectedObject reference(
+        many_ids[i], many_distances[i], many_velocities[i] - ego.speed,
+        many_accelerations[i] - ego.acceleration);
+    const DetectedObject &object = tracker.getObjects()[i];
+    EXPECT_EQ(object.getId(), reference.getId());
+    EXPECT_EQ(object.getRelativeVelocity(), reference.getRelativeVelocity());
+    EXPECT_EQ(object.getCollisionTime(), reference.getCollisionTime());
+    EXPECT_EQ(object.getThreatLevel(), reference.getThreatLevel());
+    EXPECT_EQ(columnar.getRelativeVelocities()[i],
+              reference.getRelativeVelocity());
+    EXPECT_EQ(columnar.getCollisionTimes()[i], reference.getCollisionTime());
+    EXPECT_EQ(columnar.getThreatLevels()[i], reference.getThreatLevel());
+  }
+}
+
+TEST(SimdKernels, ThresholdScanMatchesScalarPredicate) {
+  std::vector<float> distances;
+  std::vector<float> velocities;
+  makeFrame(distances, velocities);
+  std::vector<float> collision_times(distances.size());
+  std::vector<float> threat_levels(distances.size());
+  simd::computeCollisionTimes(distances.data(), velocities.data(),
+                              collision_times.data(), threat_levels.data(),
+                              distances.size());
+  collision_times.push_back(-std::numeric_limits<float>::infinity());
+
+  std::vector<std::size_t> indices(collision_times.size());
+  for (float threshold : {-1.0f, 0.0f, 1.0f, 2.0f, 5.0f, 1000.0f,
+                          std::numeric_limits<float>::infinity()}) {
+    std::vector<std::size_t> expected;
+    for (std::size_t i = 0; i < collision_times.size(); ++i) {
+      if (!std::isinf(collision_times[i]) &&
+          collision_times[i] <= threshold) {
+        expected.push_back(i);
+      }
+    }
+
+    const std::size_t count = simd::filterWithinThreshold(
+        collision_times.data(), collision_times.size(), threshold,
+        indices.data());
+    EXPECT_EQ(std::vector<std::size_t>(indices.begin(),
+                                       indices.begin() +
+                                           static_cast<std::ptrdiff_t>(count)),
+              expected)
+        << "Threshold " << threshold;
+    EXPECT_EQ(simd::anyWithinThreshold(collision_times.data(),
+                                       collision_times.size(), threshold),
+              !expected.empty())
+        << "Threshold " << threshold;
+  }
+}
+
+TEST(SimdKernels, AnyWithinThresholdFindsMatchInTail) {
+  std::vector<float> collision_times(37,
+                                     std::numeric_limits<float>::infinity());
+  EXPECT_FALSE(simd::anyWithinThreshold(collision_times.data(),
+                                        collision_times.size(), 2.0f));
+
+  collision_times.back() = 1.5f;
+  EXPECT_TRUE(simd::anyWithinThreshold(collision_times.data(),
+                                       collision_times.size(), 2.0f))
+      << "A match after the last full block must still be found.";
+}
+
+} // namespace test
+} // namespace object_tracking
+} // namespace aeb
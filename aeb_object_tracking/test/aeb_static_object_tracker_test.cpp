@@ -0,0 +1,93 @@
+/// @file aeb_static_object_tracker_test.cpp
+
+#include "../include/aeb_static_object_tracker.h"
+#include "gtest/gtest.h"  // for AssertionResult, Test, Message, TestPartResult
+
+namespace aeb {
+namespace object_tracking {
+namespace test {
+
+static_assert(StaticObjectTracker<8>::capacity() == 8U);
+static_assert(
+    StaticObjectTracker<8, OverflowPolicy::kReject>::overflowPolicy() ==
+    OverflowPolicy::kReject);
+
+// The inline storage is constant-initialized: an empty tracker can be built
+// and queried at compile time.
+constexpr StaticObjectTracker<4> kEmptyTracker{};
+static_assert(kEmptyTracker.empty() && kEmptyTracker.size() == 0U);
+static_assert(kEmptyTracker.getObjects().empty());
+static_assert(kEmptyTracker.overflowCount() == 0U);
+static_assert(DetectedObject{}.getId() == 0 &&
+              DetectedObject{}.getThreatLevel() == 0.0f);
+
+TEST(StaticObjectTracker, MatchesDynamicTrackerBelowCapacity) {
+  StaticObjectTracker<16> fixed;
+  AEBObjectTracker dynamic;
+  for (int id = 0; id < 10; ++id) {
+    const DetectedObject object(id, 10.0f + static_cast<float>(id * 7 % 10),
+                                -2.0f - static_cast<float>(id % 4));
+    EXPECT_TRUE(fixed.addObject(object));
+    dynamic.addObject(object);
+  }
+
+  fixed.partialSortCriticalObjects(3U);
+  dynamic.partialSortCriticalObjects(3U);
+  const ObjectRange critical = fixed.getCriticalObjectsView(3U);
+  ASSERT_EQ(critical.size(), 3U);
+  for (std::size_t i = 0; i < critical.size(); ++i) {
+    EXPECT_EQ(critical[i].getCollisionTime(),
+              dynamic.getCriticalObjectsView(3U)[i].getCollisionTime());
+  }
+
+  EXPECT_EQ(fixed.hasCriticalObjects(2.0f), dynamic.hasCriticalObjects(2.0f));
+  EXPECT_EQ(fixed.findObjectById(4)->getId(), 4);
+  EXPECT_EQ(fixed.findObjectById(99), fixed.getObjects().end());
+  EXPECT_EQ(fixed.overflowCount(), 0U);
+}
+
+TEST(StaticObjectTracker, RejectPolicyKeepsStoredObjects) {
+  StaticObjectTracker<2, OverflowPolicy::kReject> tracker;
+  EXPECT_TRUE(tracker.addObject(DetectedObject(1, 50.0f, -10.0f)));
+  EXPECT_TRUE(tracker.addObject(DetectedObject(2, 40.0f, -10.0f)));
+  EXPECT_TRUE(tracker.full());
+  EXPECT_FALSE(tracker.addObject(DetectedObject(3, 1.0f, -10.0f)));
+  EXPECT_EQ(tracker.findObjectById(3), tracker.getObjects().end());
+  EXPECT_EQ(tracker.overflowCount(), 1U);
+}
+
+TEST(StaticObjectTracker, DropLeastCriticalPolicyKeepsTopN) {
+  StaticObjectTracker<3, OverflowPolicy::kDropLeastCritical> tracker;
+  tracker.addObject(DetectedObject(1, 50.0f, -10.0f)); // 5.0s
+  tracker.addObject(DetectedObject(2, 100.0f, 5.0f));  // INF
+  tracker.addObject(DetectedObject(3, 20.0f, -10.0f)); // 2.0s
+
+  EXPECT_TRUE(tracker.addObject(DetectedObject(4, 10.0f, -10.0f)))
+      << "A more critical object replaces the least critical one.";
+  EXPECT_EQ(tracker.findObjectById(2), tracker.getObjects().end());
+  EXPECT_FALSE(tracker.addObject(DetectedObject(5, 90.0f, -10.0f)))
+      << "An object less critical than all stored ones is dropped.";
+
+  tracker.sortByCollisionTime();
+  EXPECT_EQ(tracker.getObjects()[0].getId(), 4);
+  EXPECT_EQ(tracker.getObjects()[2].getId(), 1);
+}
+
+TEST(StaticObjectTracker, EvictFarthestPolicyKeepsClosest) {
+  StaticObjectTracker<2, OverflowPolicy::kEvictFarthest> tracker;
+  tracker.addObject(DetectedObject(1, 30.0f, 5.0f));
+  tracker.addObject(DetectedObject(2, 80.0f, -40.0f));
+
+  EXPECT_TRUE(tracker.addObject(DetectedObject(3, 50.0f, 1.0f)));
+  EXPECT_EQ(tracker.findObjectById(2), tracker.getObjects().end())
+      << "The farthest object is evicted even if it is the most critical.";
+  EXPECT_FALSE(tracker.addObject(DetectedObject(4, 60.0f, -1.0f)));
+
+  tracker.clear();
+  EXPECT_TRUE(tracker.empty());
+  EXPECT_EQ(tracker.overflowCount(), 2U);
+}
+
+} // namespace test
+} // namespace object_tracking
+} // namespace aeb
@@ -0,0 +1,136 @@
+/// @file aeb_streaming_consumer_test.cpp
+
+#include "../include/aeb_streaming_consumer.h"
+#include "../include/aeb_tracker.h"
+#include "gtest/gtest.h"  // for AssertionResult, Test, Message, TestPartResult
+#include <cmath>          // for isinf
+#include <cstddef>        // for size_t
+#include <vector>         // for vector
+
+namespace aeb {
+namespace object_tracking {
+namespace test {
+
+namespace {
+
+const std::vector<float> kBands = {0.5f, 1.0f, 2.0f, 4.0f};
+
+struct RadarScan {
+  std::vector<int> ids;
+  std::vector<float> distances;
+  std::vector<float> velocities;
+};
+
+/// Scan whose size is not a multiple of the consumer's chunk size.
+RadarScan makeScan(std::size_t count) {
+  RadarScan scan;
+  for (std::size_t i = 0; i < count; ++i) {
+    const auto seed = static_cast<int>(i);
+    scan.ids.push_back(seed);
+    scan.distances.push_back(0.5f +
+                             static_cast<float>(seed * 7919 % 3001) * 0.1f);
+    scan.velocities.push_back(-60.0f + static_cast<float>(seed * 31 % 67));
+  }
+  return scan;
+}
+
+} // namespace
+
+TEST(StreamingObjectConsumer, MatchesFullFrameAnalysis) {
+  constexpr std::size_t kMaxObjects = 8U;
+  const RadarScan scan = makeScan(20011U);
+
+  AEBObjectTracker tracker;
+  std::vector<std::size_t> expected_counts(kBands.size(), 0U);
+  std::size_t expected_beyond = 0U;
+  for (std::size_t i = 0; i < scan.ids.size(); ++i) {
+    const DetectedObject object(scan.ids[i], scan.distances[i],
+                                scan.velocities[i]);
+    tracker.addObject(object);
+    std::size_t band = 0U;
+    while (band < kBands.size() &&
+           !(object.getCollisionTime() <= kBands[band])) {
+      ++band;
+    }
+    if (band == kBands.size() || std::isinf(object.getCollisionTime())) {
+      ++expected_beyond;
+    } else {
+      ++expected_counts[band];
+    }
+  }
+  tracker.partialSortCriticalObjects(kMaxObjects);
+  const auto expected_critical = tracker.getCriticalObjects(kMaxObjects);
+
+  StreamingObjectConsumer consumer(kMaxObjects, kBands);
+  consumer.consume(scan.ids.data(), scan.distances.data(),
+                   scan.velocities.data(), scan.ids.size());
+
+  EXPECT_EQ(consumer.consumedCount(), scan.ids.size());
+  EXPECT_EQ(consumer.beyondBandsCount(), expected_beyond);
+  for (std::size_t band = 0; band < kBands.size(); ++band) {
+    EXPECT_EQ(consumer.bands().count(band), expected_counts[band])
+        << "Band " << band;
+  }
+  const ObjectRange critical = consumer.criticalObjects();
+  ASSERT_EQ(critical.size(), kMaxObjects);
+  for (std::size_t i = 0; i < kMaxObjects; ++i) {
+    EXPECT_EQ(critical[i].getCollisionTime(),
+              expected_critical[i].getCollisionTime())
+        << "Position " << i;
+  }
+}
+
+TEST(StreamingObjectConsumer, IngestPathsAgree) {
+  const RadarScan scan = makeScan(1000U);
+  std::vector<DetectedObject> objects;
+  for (std::size_t i = 0; i < scan.ids.size(); ++i) {
+    objects.emplace_back(scan.ids[i], scan.distances[i], scan.velocities[i]);
+  }
+
+  StreamingObjectConsumer one_by_one(5U, kBands);
+  for (auto const &object : objects) {
+    one_by_one.consume(object);
+  }
+  StreamingObjectConsumer chunked(5U, kBands);
+  chunked.consume(ObjectRange(objects.data(), 600U));
+  chunked.consume(ObjectRange(objects.data() + 600, objects.size() - 600U));
+  StreamingObjectConsumer columnar(5U, kBands);
+  columnar.consume(scan.ids.data(), scan.distances.data(),
+                   scan.velocities.data(), scan.ids.size());
+
+  for (auto const *consumer : {&chunked, &columnar}) {
+    EXPECT_EQ(consumer->beyondBandsCount(), one_by_one.beyondBandsCount());
+    for (std::size_t band = 0; band < kBands.size(); ++band) {
+      EXPECT_EQ(consumer->bands().count(band), one_by_one.bands().count(band));
+      EXPECT_EQ(consumer->bands().firstIndex(band),
+                one_by_one.bands().firstIndex(band));
+    }
+    ASSERT_EQ(consumer->criticalObjects().size(), 5U);
+    for (std::size_t i = 0; i < 5U; ++i) {
+      EXPECT_EQ(consumer->criticalObjects()[i],
+                one_by_one.criticalObjects()[i]);
+    }
+  }
+}
+
+TEST(StreamingObjectConsumer, BeginScanResetsState) {
+  StreamingObjectConsumer consumer(2U, kBands);
+  consumer.consume(DetectedObject(1, 1.0f, -4.0f));
+  consumer.consume(DetectedObject(2, 50.0f, 2.0f));
+  EXPECT_EQ(consumer.bands().count(0), 1U);
+  EXPECT_EQ(consumer.beyondBandsCount(), 1U);
+
+  consumer.beginScan();
+  EXPECT_EQ(consumer.consumedCount(), 0U);
+  EXPECT_TRUE(consumer.criticalObjects().empty());
+  EXPECT_EQ(consumer.bands().countWithin(kBands.size() - 1U), 0U);
+
+  StreamingObjectConsumer counts_only(0U, kBands);
+  counts_only.consume(DetectedObject(3, 1.0f, -4.0f));
+  EXPECT_TRUE(counts_only.criticalObjects().empty());
+  EXPECT_EQ(counts_only.bands().count(0), 1U);
+}
+
+} // namespace test
+} // namespace object_tracking
+} // namespace aeb
@@ -0,0 +1,92 @@
+/// @file aeb_threshold_classification_test.cpp
+
+#include "../include/aeb_columnar_tracker.h"
+#include "../include/aeb_threshold_classification.h"
+#include "../include/aeb_tracker.h"
+#include "gtest/gtest.h"  // for AssertionResult, Test, Message, TestPartResult
+#include <vector>         // for vector
+
+namespace aeb {
+namespace object_tracking {
+namespace test {
+
+namespace {
+
+AEBObjectTracker makeTracker() {
+  AEBObjectTracker tracker;
+  tracker.addObject(DetectedObject(1, 45.0f, -12.0f)); // TTC = 3.75s
+  tracker.addObject(DetectedObject(2, 15.0f, -25.0f)); // TTC = 0.6s
+  tracker.addObject(DetectedObject(3, 80.0f, -5.0f));  // TTC = 16s
+  tracker.addObject(DetectedObject(4, 25.0f, -18.0f)); // TTC = 1.39s
+  tracker.addObject(DetectedObject(5, 120.0f, 8.0f));  // TTC = INF
+  tracker.addObject(DetectedObject(6, 35.0f, -8.0f));  // TTC = 4.38s
+  return tracker;
+}
+
+} // namespace
+
+TEST(ThresholdClassification, FusedPassMatchesSeparateQueries) {
+  const AEBObjectTracker tracker = makeTracker();
+  const std::vector<float> thresholds = {1.0f, 2.0f, 5.0f, 15.0f};
+
+  const auto classification = tracker.classifyByThresholds(thresholds, true);
+
+  ASSERT_EQ(classification.bandCount(), thresholds.size());
+  for (std::size_t band = 0; band < thresholds.size(); ++band) {
+    EXPECT_EQ(classification.anyWithin(band),
+              tracker.hasCriticalObjects(thresholds[band]))
+        << "Band " << band;
+    EXPECT_EQ(classification.countWithin(band),
+              tracker.getObjectsWithinTimeThreshold(thresholds[band]).size())
+        << "Band " << band;
+  }
+}
+
+TEST(ThresholdClassification, BandsHoldCountsFirstMatchesAndIndices) {
+  const AEBObjectTracker tracker = makeTracker();
+
+  const auto classification =
+      tracker.classifyByThresholds({2.0f, 5.0f}, true);
+
+  EXPECT_EQ(classification.count(0), 2U);
+  EXPECT_EQ(classification.count(1), 2U);
+  EXPECT_EQ(classification.firstIndex(0), 1U);
+  EXPECT_EQ(classification.firstIndex(1), 0U);
+  EXPECT_EQ(classification.firstWithin(1), 0U);
+  EXPECT_EQ(classification.indices(0), (std::vector<std::size_t>{1U, 3U}));
+  EXPECT_EQ(classification.indices(1), (std::vector<std::size_t>{0U, 5U}));
+
+  const auto without_indices = tracker.classifyByThresholds({2.0f, 5.0f});
+  EXPECT_TRUE(without_indices.indices(0).empty())
+      << "Index lists are only collected on request.";
+}
+
+TEST(ThresholdClassification, EmptyBandsReportNoMatch) {
+  const AEBObjectTracker tracker = makeTracker();
+
+  const auto classification = tracker.classifyByThresholds({0.1f, 0.5f});
+
+  EXPECT_FALSE(classification.anyWithin(1));
+  EXPECT_EQ(classification.firstWithin(1), ThresholdClassification::kNoMatch);
+}
+
+TEST(ThresholdClassification, ColumnarTrackerMatchesAoSTracker) {
+  const AEBObjectTracker tracker = makeTracker();
+  ColumnarObjectTracker columnar;
+  for (auto const &object : tracker.getObjects()) {
+    columnar.addObject(object);
+  }
+
+  ThresholdClassification columnar_classification;
+  columnar.classifyByThresholds({2.0f, 5.0f}, columnar_classification, true);
+  const auto classification = tracker.classifyByThresholds({2.0f, 5.0f}, true);
+
+  for (std::size_t band = 0; band < 2U; ++band) {
+    EXPECT_EQ(columnar_classification.indices(band),
+              classification.indices(band));
+  }
+}
+
+} // namespace test
+} // namespace object_tracking
+} // namespace aeb
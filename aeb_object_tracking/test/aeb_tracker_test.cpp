@@ -2,6 +2,7 @@
 
 #include "../include/aeb_tracker.h"
 #include "gtest/gtest.h"  // for AssertionResult, Test, Message, TestPartResult
+#include <vector>         // for vector
 
 /// TODO: ADD more unit tests
 
@@ -98,6 +99,125 @@ TEST(AEBComparators, ThreatLevelZeroDistance)
 
 }
 
+TEST(AEBObjectTrackerViews, CriticalObjectsViewAliasesSortedPrefix) {
+  AEBObjectTracker tracker;
+  tracker.addObject(DetectedObject(1, 50.0f, -10.0f)); // TTC = 5.0s
+  tracker.addObject(DetectedObject(2, 20.0f, -20.0f)); // TTC = 1.0s
+  tracker.addObject(DetectedObject(3, 100.0f, 5.0f));  // TTC = INF
+  tracker.partialSortCriticalObjects(2);
+
+  const ObjectRange view = tracker.getCriticalObjectsView(2);
+  const auto copy = tracker.getCriticalObjects(2);
+
+  ASSERT_EQ(view.size(), copy.size());
+  EXPECT_EQ(view.data(), tracker.getObjects().data())
+      << "The view must refer to the tracker storage instead of a copy.";
+  for (std::size_t i = 0; i < view.size(); ++i) {
+    EXPECT_EQ(view[i].getId(), copy[i].getId());
+  }
+  EXPECT_EQ(tracker.getCriticalObjectsView(10).size(), 3U);
+}
+
+TEST(AEBObjectTrackerViews, ThresholdViewMatchesCopyingQuery) {
+  AEBObjectTracker tracker;
+  tracker.addObject(DetectedObject(1, 15.0f, -20.0f)); // TTC = 0.75s
+  tracker.addObject(DetectedObject(2, 50.0f, -5.0f));  // TTC = 10s
+  tracker.addObject(DetectedObject(3, 100.0f, 2.0f));  // TTC = INF
+  tracker.addObject(DetectedObject(4, 30.0f, -20.0f)); // TTC = 1.5s
+
+  for (float threshold : {0.5f, 1.0f, 2.0f, 15.0f}) {
+    const auto copy = tracker.getObjectsWithinTimeThreshold(threshold);
+    const auto view = tracker.getObjectsWithinTimeThresholdView(threshold);
+    std::vector<std::size_t> indices;
+    tracker.getObjectIndicesWithinTimeThreshold(threshold, indices);
+
+    ASSERT_EQ(view.count(), copy.size()) << "Threshold " << threshold;
+    ASSERT_EQ(indices.size(), copy.size()) << "Threshold " << threshold;
+    EXPECT_EQ(view.empty(), copy.empty());
+    std::size_t i = 0;
+    for (auto const &object : view) {
+      EXPECT_EQ(object.getId(), copy[i].getId());
+      EXPECT_EQ(tracker.getObjects()[indices[i]].getId(), copy[i].getId());
+      ++i;
+    }
+  }
+}
+
+TEST(AEBObjectTrackerUpdates, UpdateObjectRecomputesInPlace) {
+  AEBObjectTracker tracker;
+  tracker.addObject(DetectedObject(1, 50.0f, -10.0f));
+  tracker.addObject(DetectedObject(2, 20.0f, -20.0f));
+
+  EXPECT_TRUE(tracker.updateObject(1, 10.0f, -10.0f));
+  EXPECT_FALSE(tracker.updateObject(3, 10.0f, -10.0f));
+
+  ASSERT_EQ(tracker.size(), 2U);
+  EXPECT_EQ(tracker.getObjects()[0].getId(), 1);
+  EXPECT_FLOAT_EQ(tracker.getObjects()[0].getCollisionTime(), 1.0f);
+}
+
+TEST(AEBObjectTrackerUpdates, UpdateFrameAddsNewTracksAndResorts) {
+  AEBObjectTracker tracker;
+  tracker.enableIdIndex(true);
+  std::vector<int> ids;
+  std::vector<float> distances;
+  std::vector<float> velocities;
+  for (int id = 0; id < 200; ++id) {
+    ids.push_back(id);
+    distances.push_back(10.0f + static_cast<float>(id));
+    velocities.push_back(-10.0f);
+  }
+
+  EXPECT_EQ(tracker.updateFrame(ids.data(), distances.data(),
+                                velocities.data(), ids.size()),
+            200U);
+  tracker.sortByCollisionTime();
+
+  // Next frame: everything moves 0.2m closer, a few tracks swap places.
+  for (auto &distance : distances) {
+    distance -= 0.2f;
+  }
+  distances[50] = 5.0f;
+  distances[3] = 500.0f;
+  ids.push_back(1000);
+  distances.push_back(100.5f);
+  velocities.push_back(-10.0f);
+  EXPECT_EQ(tracker.updateFrame(ids.data(), distances.data(),
+                                velocities.data(), ids.size()),
+            1U);
+
+  tracker.resortByCollisionTime();
+
+  const auto &objects = tracker.getObjects();
+  ASSERT_EQ(objects.size(), 201U);
+  for (std::size_t i = 1; i < objects.size(); ++i) {
+    EXPECT_FALSE(AEBObjectTracker::Comparators::byCollisionTime(objects[i],
+                                                                objects[i - 1]))
+        << "Order broken at position " << i;
+  }
+  EXPECT_EQ(objects.front().getId(), 50);
+  EXPECT_EQ(tracker.findObjectById(3)->getDistance(), 500.0f);
+}
+
+TEST(AEBObjectTrackerUpdates, IncrementalTopKFollowsUpdates) {
+  AEBObjectTracker tracker;
+  tracker.setIncrementalCriticalObjects(3);
+  for (int id = 0; id < 20; ++id) {
+    tracker.addObject(
+        DetectedObject(id, 10.0f + static_cast<float>(id), -10.0f));
+  }
+
+  // Demote the most critical object below every other one.
+  ASSERT_TRUE(tracker.updateObject(0, 90.0f, -10.0f));
+  // Promote an object from outside the set.
+  ASSERT_TRUE(tracker.updateObject(15, 1.0f, -10.0f));
+
+  const auto critical = tracker.getCriticalObjects(3);
+  ASSERT_EQ(critical.size(), 3U);
+  EXPECT_EQ(critical[0].getId(), 15);
+  EXPECT_EQ(critical[1].getId(), 1);
+  EXPECT_EQ(critical[2].getId(), 2);
+}
 
 } // namespace test
 } // namespace object_tracking